@@ -0,0 +1,281 @@
+// PinVarCommandlet.cpp
+#include "PinVarCommandlet.h"
+
+#include "Editor.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "FileHelpers.h"
+
+#include "PinVarCsv.h"
+#include "PinVarSubsystem.h"
+
+UPinVarCommandlet::UPinVarCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+	HelpDescription = TEXT("Validate, prune, export or import PinVar pins or pinned values without opening the editor UI.");
+	HelpUsage = TEXT("-run=PinVar -Mode=Validate|Prune|Export|Import|ExportValues|ImportValues [-File=] [-Report=] [-Out=] [-In=] [-Replace]");
+}
+
+int32 UPinVarCommandlet::Main(const FString& Params)
+{
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamsMap;
+	ParseCommandLine(*Params, Tokens, Switches, ParamsMap);
+
+	UPinVarSubsystem* Subsystem = GEditor ? GEditor->GetEditorSubsystem<UPinVarSubsystem>() : nullptr;
+	if (!Subsystem)
+	{
+		UE_LOG(LogTemp, Error, TEXT("PinVar: commandlet needs the editor subsystem (run through UnrealEditor-Cmd)."));
+		return 2;
+	}
+
+	if (const FString* File = ParamsMap.Find(TEXT("File")))
+	{
+		Subsystem->PinsFileOverride = FPaths::ConvertRelativePathToFull(*File);
+	}
+	if (!FPaths::FileExists(Subsystem->GetActivePinsFilePath()))
+	{
+		// Import may create it; everything else just sees an empty pin set
+		UE_LOG(LogTemp, Warning, TEXT("PinVar: no pins file at %s"), *Subsystem->GetActivePinsFilePath());
+		// settle the project file's startup parse first so it cannot land on top of the empty set
+		Subsystem->EnsurePinsLoaded();
+		Subsystem->StagedPinnedGroups.Reset();
+		Subsystem->MergeStagedIntoPinned();
+	}
+	else if (!Subsystem->LoadFromDisk())
+	{
+		UE_LOG(LogTemp, Error, TEXT("PinVar: could not read %s"), *Subsystem->GetActivePinsFilePath());
+		return 2;
+	}
+
+	const FString Mode = ParamsMap.FindRef(TEXT("Mode"));
+	if (Mode.Equals(TEXT("Validate"), ESearchCase::IgnoreCase)) return RunValidate(*Subsystem, ParamsMap, false);
+	if (Mode.Equals(TEXT("Prune"), ESearchCase::IgnoreCase)) return RunValidate(*Subsystem, ParamsMap, true);
+	if (Mode.Equals(TEXT("Export"), ESearchCase::IgnoreCase)) return RunExport(*Subsystem, ParamsMap);
+	if (Mode.Equals(TEXT("Import"), ESearchCase::IgnoreCase)) return RunImport(*Subsystem, ParamsMap, Switches);
+	if (Mode.Equals(TEXT("ExportValues"), ESearchCase::IgnoreCase)) return RunExportValues(*Subsystem, ParamsMap);
+	if (Mode.Equals(TEXT("ImportValues"), ESearchCase::IgnoreCase)) return RunImportValues(*Subsystem, ParamsMap);
+
+	UE_LOG(LogTemp, Error, TEXT("PinVar: unknown -Mode='%s'. Usage: %s"), *Mode, *HelpUsage);
+	return 2;
+}
+
+int32 UPinVarCommandlet::RunValidate(UPinVarSubsystem& Subsystem, const TMap<FString, FString>& ParamsMap,
+                                     bool bPrune)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	// discovery has to be complete before "class not found" means anything
+	IAssetRegistry& AR = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	AR.SearchAllAssets(/*bSynchronousSearch*/ true);
+
+	TMap<FName, FSoftObjectPath> ClassIndex;
+	UPinVarSubsystem::BuildGeneratedClassIndex(ClassIndex);
+
+	// everything that is not resident yet goes into one async batch instead of a sync load per pin
+	TArray<FSoftObjectPath> ToLoad;
+	{
+		TSet<FSoftObjectPath> Unique;
+		for (const TPair<FName, TArray<FPinnedVariable>>& Pair : Subsystem.StagedPinnedGroups)
+		{
+			const FString Name = Pair.Key.ToString();
+			if (!FindFirstObjectSafe<UClass>(*Name))
+			{
+				const FName GenName(*(Name.EndsWith(TEXT("_C")) ? Name : Name + TEXT("_C")));
+				if (const FSoftObjectPath* ClassPath = ClassIndex.Find(GenName))
+				{
+					Unique.Add(*ClassPath);
+				}
+			}
+			for (const FPinnedVariable& E : Pair.Value)
+			{
+				if (!E.AssetPath.IsNull() && !E.AssetPath.ResolveObject())
+				{
+					Unique.Add(E.AssetPath);
+				}
+			}
+		}
+		ToLoad = Unique.Array();
+	}
+
+	TSharedPtr<FStreamableHandle> Handle;
+	if (ToLoad.Num() > 0)
+	{
+		UE_LOG(LogTemp, Display, TEXT("PinVar: loading %d classes/assets..."), ToLoad.Num());
+		Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(ToLoad);
+		if (Handle.IsValid())
+		{
+			Handle->WaitUntilComplete();
+		}
+	}
+	Subsystem.RepopulateSessionCacheAll();
+
+	struct FBroken
+	{
+		FName ClassName;
+		FPinnedVariable Pin;
+	};
+	TArray<FBroken> Broken;
+	TArray<FString> ReportLines;
+	ReportLines.Add(TEXT("Class,Variable,Group,Component,Asset,Result"));
+	int32 Checked = 0;
+
+	for (const TPair<FName, TArray<FPinnedVariable>>& Pair : Subsystem.StagedPinnedGroups)
+	{
+		UClass* Cls = UPinVarSubsystem::ResolveClassByName(Pair.Key, &ClassIndex);
+		for (const FPinnedVariable& E : Pair.Value)
+		{
+			UObject* Target = nullptr;
+			FProperty* Prop = nullptr;
+			const EPinVarResolveResult Result = Subsystem.ResolvePin(Pair.Key, Cls, E, Target, Prop);
+			++Checked;
+
+			FString Line;
+			PinVarCsv::AppendField(Line, Pair.Key.ToString());
+			PinVarCsv::AppendField(Line, E.VariableName.ToString());
+			PinVarCsv::AppendField(Line, Subsystem.GroupTable.GetPathList(E.GroupIds));
+			PinVarCsv::AppendField(Line, E.ComponentTemplateName.ToString());
+			PinVarCsv::AppendField(Line, E.AssetPath.ToString());
+			PinVarCsv::AppendField(Line, LexToString(Result));
+			ReportLines.Add(MoveTemp(Line));
+			if (Result == EPinVarResolveResult::Ok) continue;
+
+			UE_LOG(LogTemp, Warning, TEXT("PinVar: %s - %s.%s (group '%s'%s%s)"), LexToString(Result),
+			       *Pair.Key.ToString(), *E.VariableName.ToString(), *Subsystem.GroupTable.GetPathList(E.GroupIds),
+			       E.ComponentTemplateName.IsNone() ? TEXT("") : *(TEXT(", component ") + E.ComponentTemplateName.ToString()),
+			       E.AssetPath.IsNull() ? TEXT("") : *(TEXT(", asset ") + E.AssetPath.ToString()));
+			Broken.Add({Pair.Key, E});
+		}
+	}
+
+	if (const FString* ReportPath = ParamsMap.Find(TEXT("Report")))
+	{
+		FFileHelper::SaveStringArrayToFile(ReportLines, **ReportPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("PinVar: checked %d pins, %d broken (%.2fs)."),
+	       Checked, Broken.Num(), FPlatformTime::Seconds() - StartTime);
+
+	if (!bPrune)
+	{
+		return Broken.Num() > 0 ? 1 : 0;
+	}
+
+	for (const FBroken& B : Broken)
+	{
+		Subsystem.UnstagePinVariable(B.ClassName, B.Pin.VariableName, 0,
+		                             B.Pin.ComponentTemplateName, B.Pin.AssetPath);
+	}
+	if (Broken.Num() > 0)
+	{
+		Subsystem.MergeStagedIntoPinned();
+		if (!Subsystem.SaveToDisk()) return 2;
+		UE_LOG(LogTemp, Display, TEXT("PinVar: pruned %d pins."), Broken.Num());
+	}
+	return 0;
+}
+
+int32 UPinVarCommandlet::RunExport(UPinVarSubsystem& Subsystem, const TMap<FString, FString>& ParamsMap)
+{
+	const FString* Out = ParamsMap.Find(TEXT("Out"));
+	if (!Out || Out->IsEmpty())
+	{
+		UE_LOG(LogTemp, Error, TEXT("PinVar: Export needs -Out=<file>."));
+		return 2;
+	}
+
+	Subsystem.PinsFileOverride = FPaths::ConvertRelativePathToFull(*Out);
+	return Subsystem.SaveToDisk() ? 0 : 2;
+}
+
+int32 UPinVarCommandlet::RunImport(UPinVarSubsystem& Subsystem, const TMap<FString, FString>& ParamsMap,
+                                   const TArray<FString>& Switches)
+{
+	const FString* In = ParamsMap.Find(TEXT("In"));
+	if (!In || In->IsEmpty())
+	{
+		UE_LOG(LogTemp, Error, TEXT("PinVar: Import needs -In=<file>."));
+		return 2;
+	}
+
+	// parse the other file on its own; its group ids mean nothing in our table, so they go over by path
+	FPinVarPinsFile Incoming;
+	if (!UPinVarSubsystem::ParsePinsFile(FPaths::ConvertRelativePathToFull(*In), Incoming))
+	{
+		UE_LOG(LogTemp, Error, TEXT("PinVar: could not read %s"), **In);
+		return 2;
+	}
+
+	const bool bReplace = Switches.ContainsByPredicate([](const FString& S)
+	{
+		return S.Equals(TEXT("Replace"), ESearchCase::IgnoreCase);
+	});
+	if (bReplace)
+	{
+		Subsystem.StagedPinnedGroups.Reset();
+		Subsystem.GroupTable.Reset();
+	}
+
+	int32 Added = 0;
+	for (TPair<FName, TArray<FPinnedVariable>>& Pair : Incoming.Pins)
+	{
+		for (FPinnedVariable& E : Pair.Value)
+		{
+			TArray<int32> Ids;
+			for (const int32 Id : E.GroupIds)
+			{
+				const int32 Mapped = Subsystem.GroupTable.FindOrAddPath(Incoming.Groups.GetPath(Id));
+				if (Mapped != 0) Ids.AddUnique(Mapped);
+			}
+			E.GroupIds = MoveTemp(Ids);
+		}
+		Added += Subsystem.StagePinBatch(Pair.Key, Pair.Value);
+	}
+	Subsystem.MergeStagedIntoPinned();
+
+	UE_LOG(LogTemp, Display, TEXT("PinVar: imported %d new pins from %s."), Added, **In);
+	return Subsystem.SaveToDisk() ? 0 : 2;
+}
+
+int32 UPinVarCommandlet::RunExportValues(UPinVarSubsystem& Subsystem, const TMap<FString, FString>& ParamsMap)
+{
+	const FString Out = ParamsMap.Contains(TEXT("Out"))
+		                    ? FPaths::ConvertRelativePathToFull(ParamsMap[TEXT("Out")])
+		                    : UPinVarSubsystem::GetValuesCsvPath();
+	IAssetRegistry& AR = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	AR.SearchAllAssets(/*bSynchronousSearch*/ true);
+
+	return Subsystem.ExportValuesCsv(Out) != INDEX_NONE ? 0 : 2;
+}
+
+int32 UPinVarCommandlet::RunImportValues(UPinVarSubsystem& Subsystem, const TMap<FString, FString>& ParamsMap)
+{
+	const FString In = ParamsMap.Contains(TEXT("In"))
+		                   ? FPaths::ConvertRelativePathToFull(ParamsMap[TEXT("In")])
+		                   : UPinVarSubsystem::GetValuesCsvPath();
+	IAssetRegistry& AR = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	AR.SearchAllAssets(/*bSynchronousSearch*/ true);
+
+	TArray<FPinVarValueChange> Changes;
+	int32 RowsRead = 0;
+	int32 RowsSkipped = 0;
+	if (!Subsystem.ReadValuesCsv(In, Changes, RowsRead, RowsSkipped)) return 2;
+	if (Changes.Num() == 0) return 0;
+
+	TArray<FPinVarValueWrite> Writes;
+	Writes.Reserve(Changes.Num());
+	for (FPinVarValueChange& C : Changes) { Writes.Add(MoveTemp(C.Write)); }
+	Subsystem.ApplyValueBatch(Writes, FText::FromString(TEXT("PinVar: Import Values CSV")));
+
+	// nobody is around to save what the import dirtied
+	return UEditorLoadingAndSavingUtils::SaveDirtyPackages(/*bSaveMapPackages*/ false, /*bSaveContentPackages*/ true)
+		       ? 0
+		       : 2;
+}
@@ -0,0 +1,45 @@
+// PinVarCsv.h
+#pragma once
+
+#include "CoreMinimal.h"
+
+// RFC 4180-style fields shared by the values CSV and the commandlet's validation report.
+namespace PinVarCsv
+{
+	inline void AppendField(FString& Line, const FString& Field)
+	{
+		if (!Line.IsEmpty()) Line.AppendChar(TEXT(','));
+		int32 Unused;
+		if (!Field.FindChar(TEXT(','), Unused) && !Field.FindChar(TEXT('"'), Unused) &&
+			!Field.FindChar(TEXT('\n'), Unused) && !Field.FindChar(TEXT('\r'), Unused))
+		{
+			Line += Field;
+			return;
+		}
+		Line.AppendChar(TEXT('"'));
+		Line += Field.Replace(TEXT("\""), TEXT("\"\""));
+		Line.AppendChar(TEXT('"'));
+	}
+
+	// one record; quoted fields may hold commas, doubled quotes and line breaks
+	inline void SplitLine(FStringView Line, TArray<FString>& OutFields)
+	{
+		OutFields.Reset();
+		FString Field;
+		bool bQuoted = false;
+		for (int32 i = 0; i < Line.Len(); ++i)
+		{
+			const TCHAR C = Line[i];
+			if (bQuoted)
+			{
+				if (C != TEXT('"')) { Field.AppendChar(C); }
+				else if (i + 1 < Line.Len() && Line[i + 1] == TEXT('"')) { Field.AppendChar(C); ++i; }
+				else { bQuoted = false; }
+			}
+			else if (C == TEXT('"')) { bQuoted = true; }
+			else if (C == TEXT(',')) { OutFields.Add(MoveTemp(Field)); Field.Reset(); }
+			else if (C != TEXT('\r')) { Field.AppendChar(C); }
+		}
+		OutFields.Add(MoveTemp(Field));
+	}
+}
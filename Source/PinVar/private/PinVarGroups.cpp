@@ -0,0 +1,307 @@
+// PinVarGroups.cpp
+#include "PinVarGroups.h"
+#include "Dom/JsonObject.h"
+
+int32 FPinVarGroupTable::FindOrAddPath(const FString& Path)
+{
+	TArray<FString> Segs;
+	Path.ParseIntoArray(Segs, TEXT("|"), /*CullEmpty*/ true);
+
+	int32 Parent = 0;
+	for (FString& S : Segs)
+	{
+		S.TrimStartAndEndInline();
+		if (S.IsEmpty()) continue;
+
+		const FName Name(*S);
+		int32 Id = FindChild(Parent, Name);
+		if (Id == 0)
+		{
+			Id = NextId++;
+			Records.Add(Id).Name = Name;
+			Attach(Id, Parent);
+		}
+		Parent = Id;
+	}
+	return Parent;
+}
+
+int32 FPinVarGroupTable::FindPath(const FString& Path) const
+{
+	TArray<FString> Segs;
+	Path.ParseIntoArray(Segs, TEXT("|"), /*CullEmpty*/ true);
+
+	int32 Id = 0;
+	for (FString& S : Segs)
+	{
+		S.TrimStartAndEndInline();
+		if (S.IsEmpty()) continue;
+
+		Id = FindChild(Id, FName(*S));
+		if (Id == 0) return 0;
+	}
+	return Id;
+}
+
+int32 FPinVarGroupTable::AddPathList(const FString& List, TArray<int32>& InOutIds)
+{
+	TArray<FString> Tokens;
+	List.ParseIntoArray(Tokens, TEXT(","), /*CullEmpty*/ true);
+
+	int32 Added = 0;
+	for (const FString& Tok : Tokens)
+	{
+		const int32 Id = FindOrAddPath(Tok);
+		if (Id == 0 || InOutIds.Contains(Id)) continue;
+		InOutIds.Add(Id);
+		++Added;
+	}
+	return Added;
+}
+
+int32 FPinVarGroupTable::Resolve(int32 Id) const
+{
+	// merge chains are short; a bounded walk also survives a hand-edited cycle
+	for (int32 Hops = 0; Hops < 64; ++Hops)
+	{
+		const FPinVarGroup* G = Records.Find(Id);
+		if (!G) return 0;
+		if (G->MergedInto == 0) return Id;
+		Id = G->MergedInto;
+	}
+	return 0;
+}
+
+const FPinVarGroup* FPinVarGroupTable::Find(int32 Id) const
+{
+	return Records.Find(Resolve(Id));
+}
+
+FName FPinVarGroupTable::GetName(int32 Id) const
+{
+	const FPinVarGroup* G = Find(Id);
+	return G ? G->Name : NAME_None;
+}
+
+FString FPinVarGroupTable::GetPath(int32 Id) const
+{
+	FString Path;
+	for (const FPinVarGroup* G = Find(Id); G; G = G->ParentId ? Find(G->ParentId) : nullptr)
+	{
+		Path = Path.IsEmpty() ? G->Name.ToString() : G->Name.ToString() + TEXT("|") + Path;
+	}
+	return Path;
+}
+
+FString FPinVarGroupTable::GetPathList(const TArray<int32>& Ids) const
+{
+	return FString::JoinBy(Ids, TEXT(", "), [this](const int32 Id) { return GetPath(Id); });
+}
+
+void FPinVarGroupTable::GetAncestry(int32 Id, TArray<int32>& OutChain) const
+{
+	OutChain.Reset();
+	for (Id = Resolve(Id); Id != 0; Id = Resolve(Records[Id].ParentId))
+	{
+		OutChain.Insert(Id, 0);
+	}
+}
+
+void FPinVarGroupTable::GetAllPaths(TArray<FString>& OutPaths) const
+{
+	OutPaths.Reserve(OutPaths.Num() + Records.Num());
+	for (const TPair<int32, FPinVarGroup>& Pair : Records)
+	{
+		if (Pair.Value.MergedInto == 0) OutPaths.Add(GetPath(Pair.Key));
+	}
+}
+
+bool FPinVarGroupTable::IsAncestorOf(int32 AncestorId, int32 Id) const
+{
+	AncestorId = Resolve(AncestorId);
+	for (const FPinVarGroup* G = Find(Id); G && G->ParentId != 0; G = Find(G->ParentId))
+	{
+		if (Resolve(G->ParentId) == AncestorId) return true;
+	}
+	return false;
+}
+
+bool FPinVarGroupTable::Rename(int32 Id, FName NewName)
+{
+	Id = Resolve(Id);
+	FPinVarGroup* G = Records.Find(Id);
+	if (!G || NewName.IsNone() || G->Name.IsEqual(NewName, ENameCase::CaseSensitive)) return false;
+
+	const int32 Sibling = FindChild(G->ParentId, NewName);
+	if (Sibling != 0 && Sibling != Id)
+	{
+		return Merge(Id, Sibling);
+	}
+
+	ChildIndex.Remove(TPair<int32, FName>(G->ParentId, G->Name));
+	G->Name = NewName;
+	ChildIndex.Add(TPair<int32, FName>(G->ParentId, NewName), Id);
+	return true;
+}
+
+bool FPinVarGroupTable::Move(int32 Id, int32 NewParentId)
+{
+	Id = Resolve(Id);
+	NewParentId = NewParentId == 0 ? 0 : Resolve(NewParentId);
+	const FPinVarGroup* G = Records.Find(Id);
+	if (!G || G->ParentId == NewParentId || Id == NewParentId || IsAncestorOf(Id, NewParentId)) return false;
+
+	const int32 Sibling = FindChild(NewParentId, G->Name);
+	if (Sibling != 0)
+	{
+		return Merge(Id, Sibling);
+	}
+
+	Detach(Id);
+	Attach(Id, NewParentId);
+	return true;
+}
+
+bool FPinVarGroupTable::Merge(int32 FromId, int32 IntoId)
+{
+	FromId = Resolve(FromId);
+	IntoId = Resolve(IntoId);
+	if (FromId == 0 || IntoId == 0 || FromId == IntoId || IsAncestorOf(FromId, IntoId)) return false;
+
+	Detach(FromId);
+	TArray<int32> Kids = MoveTemp(Records[FromId].Children);
+	for (const int32 Kid : Kids)
+	{
+		const FName KidName = Records[Kid].Name;
+		ChildIndex.Remove(TPair<int32, FName>(FromId, KidName));
+
+		const int32 Same = FindChild(IntoId, KidName);
+		if (Same != 0)
+		{
+			Merge(Kid, Same);
+		}
+		else
+		{
+			Attach(Kid, IntoId);
+		}
+	}
+	Records[FromId].MergedInto = IntoId;
+	return true;
+}
+
+void FPinVarGroupTable::RemoveUnused(const TSet<int32>& UsedIds)
+{
+	TSet<int32> Keep;
+	for (const int32 Used : UsedIds)
+	{
+		// the id itself, every alias hop, then the live record's ancestors
+		int32 Id = Used;
+		for (const FPinVarGroup* G = Records.Find(Id); G; G = Records.Find(Id))
+		{
+			bool bAlreadyKept = false;
+			Keep.Add(Id, &bAlreadyKept);
+			if (bAlreadyKept) break;
+			Id = G->MergedInto != 0 ? G->MergedInto : G->ParentId;
+		}
+	}
+
+	TArray<int32> Unused;
+	for (const TPair<int32, FPinVarGroup>& Pair : Records)
+	{
+		if (!Keep.Contains(Pair.Key)) Unused.Add(Pair.Key);
+	}
+	for (const int32 Id : Unused)
+	{
+		if (Records[Id].MergedInto == 0) Detach(Id);
+	}
+	for (const int32 Id : Unused)
+	{
+		Records.Remove(Id);
+	}
+	if (Unused.Num() > 0)
+	{
+		Records.Compact();
+	}
+}
+
+void FPinVarGroupTable::Reset()
+{
+	Records.Reset();
+	ChildIndex.Reset();
+	NextId = 1;
+}
+
+void FPinVarGroupTable::Write(FJsonObject& Out) const
+{
+	// sorted by id so an edit to one group changes one record in the file
+	TArray<int32> Ids;
+	Records.GenerateKeyArray(Ids);
+	Ids.Sort();
+	for (const int32 Id : Ids)
+	{
+		const FPinVarGroup& G = Records[Id];
+		TSharedRef<FJsonObject> J = MakeShared<FJsonObject>();
+		J->SetStringField(TEXT("Name"), G.Name.ToString());
+		if (G.ParentId != 0) J->SetNumberField(TEXT("Parent"), G.ParentId);
+		if (G.MergedInto != 0) J->SetNumberField(TEXT("MergedInto"), G.MergedInto);
+		Out.SetObjectField(FString::FromInt(Id), J);
+	}
+}
+
+void FPinVarGroupTable::Read(const FJsonObject& In)
+{
+	Reset();
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& KVP : In.Values)
+	{
+		const int32 Id = FCString::Atoi(*KVP.Key);
+		const TSharedPtr<FJsonObject>* J = nullptr;
+		if (Id <= 0 || !KVP.Value.IsValid() || !KVP.Value->TryGetObject(J) || !J || !J->IsValid()) continue;
+
+		FString Name;
+		(*J)->TryGetStringField(TEXT("Name"), Name);
+		FPinVarGroup& G = Records.Add(Id);
+		G.Name = FName(*Name);
+		(*J)->TryGetNumberField(TEXT("Parent"), G.ParentId);
+		(*J)->TryGetNumberField(TEXT("MergedInto"), G.MergedInto);
+		NextId = FMath::Max(NextId, Id + 1);
+	}
+
+	// rebuild the child links; records whose parent is missing become top level
+	for (TPair<int32, FPinVarGroup>& Pair : Records)
+	{
+		if (Pair.Value.MergedInto != 0) continue;
+		const FPinVarGroup* Parent = Records.Find(Pair.Value.ParentId);
+		if (!Parent || Parent->MergedInto != 0) Pair.Value.ParentId = 0;
+	}
+	for (const TPair<int32, FPinVarGroup>& Pair : Records)
+	{
+		if (Pair.Value.MergedInto != 0) continue;
+		if (FindChild(Pair.Value.ParentId, Pair.Value.Name) != 0) continue; // duplicate name (hand-edited file): still reachable by id, not by path
+		ChildIndex.Add(TPair<int32, FName>(Pair.Value.ParentId, Pair.Value.Name), Pair.Key);
+		if (Pair.Value.ParentId != 0) Records[Pair.Value.ParentId].Children.Add(Pair.Key);
+	}
+}
+
+int32 FPinVarGroupTable::FindChild(int32 ParentId, FName Name) const
+{
+	const int32* Id = ChildIndex.Find(TPair<int32, FName>(ParentId, Name));
+	return Id ? *Id : 0;
+}
+
+void FPinVarGroupTable::Attach(int32 Id, int32 ParentId)
+{
+	FPinVarGroup& G = Records[Id];
+	G.ParentId = ParentId;
+	ChildIndex.Add(TPair<int32, FName>(ParentId, G.Name), Id);
+	if (ParentId != 0) Records[ParentId].Children.Add(Id);
+}
+
+void FPinVarGroupTable::Detach(int32 Id)
+{
+	const FPinVarGroup& G = Records[Id];
+	ChildIndex.Remove(TPair<int32, FName>(G.ParentId, G.Name));
+	if (FPinVarGroup* Parent = Records.Find(G.ParentId))
+	{
+		Parent->Children.Remove(Id);
+	}
+}
@@ -8,6 +8,30 @@
 #include "PinVarSubsystem.h"
 #include "SPinVarPanel.h"
 #include "PropertyEditorModule.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "PinVarStats.h"
+
+DEFINE_STAT(STAT_PinVar_LoadFromDisk);
+DEFINE_STAT(STAT_PinVar_SaveToDisk);
+DEFINE_STAT(STAT_PinVar_SourceControl);
+DEFINE_STAT(STAT_PinVar_Merge);
+DEFINE_STAT(STAT_PinVar_Repopulate);
+DEFINE_STAT(STAT_PinVar_ApplyValueBatch);
+DEFINE_STAT(STAT_PinVar_Preset);
+DEFINE_STAT(STAT_PinVar_ValuesCsv);
+DEFINE_STAT(STAT_PinVar_Validate);
+DEFINE_STAT(STAT_PinVar_Refresh);
+DEFINE_STAT(STAT_PinVar_Rebuild);
+DEFINE_STAT(STAT_PinVar_RefreshClasses);
+DEFINE_STAT(STAT_PinVar_Gather);
+DEFINE_STAT(STAT_PinVar_ResolveClass);
+DEFINE_STAT(STAT_PinVar_FindComponentTemplate);
+DEFINE_STAT(STAT_PinVar_TableRefresh);
+DEFINE_STAT(STAT_PinVar_PinsResolved);
+DEFINE_STAT(STAT_PinVar_AssetsRequested);
+DEFINE_STAT(STAT_PinVar_AssetsLoaded);
+DEFINE_STAT(STAT_PinVar_AssetsPrefetched);
+DEFINE_STAT(STAT_PinVar_WidgetsCreated);
 
 const FName FPinVarModule::PinVarTabName("PinVar");
 
@@ -21,9 +45,14 @@ void FPinVarModule::StartupModule()
 
 	MenuRegHandle = UToolMenus::RegisterStartupCallback(
 		FSimpleMulticastDelegate::FDelegate::CreateRaw(this, &FPinVarModule::RegisterMenus));
-	FTSTicker::GetCoreTicker().AddTicker(
-		FTickerDelegate::CreateRaw(this, &FPinVarModule::InitialRefreshOnce),
-		1.0f);
+
+	IAssetRegistry& AR = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	if (AR.IsLoadingAssets())
+	{
+		// never wait on the scan: pins appear as their assets are discovered
+		AssetAddedHandle = AR.OnAssetAdded().AddRaw(this, &FPinVarModule::OnAssetDiscovered);
+		FilesLoadedHandle = AR.OnFilesLoaded().AddRaw(this, &FPinVarModule::OnAssetDiscoveryFinished);
+	}
 }
 
 void FPinVarModule::ShutdownModule()
@@ -35,14 +64,19 @@ void FPinVarModule::ShutdownModule()
 			Subsystem->SaveToDisk();
 		}
 	}
+	UnbindAssetRegistry();
+	if (DiscoveryRefreshHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(DiscoveryRefreshHandle);
+		DiscoveryRefreshHandle.Reset();
+	}
 	UnregisterMenus();
 	FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(PinVarTabName);
 }
 
 TSharedRef<SDockTab> FPinVarModule::OnSpawnPluginTab(const FSpawnTabArgs& SpawnTabArgs)
 {
-	ScanPinnedVariables();
-
+	// built once from the subsystem's in-memory pins; the Refresh button re-reads the file
 	TSharedRef<SPinVarPanel> Panel =
 		SNew(SPinVarPanel)
 		.OnRefreshRequested(FSimpleDelegate::CreateRaw(this, &FPinVarModule::ScanPinnedVariables));
@@ -52,8 +86,7 @@ TSharedRef<SDockTab> FPinVarModule::OnSpawnPluginTab(const FSpawnTabArgs& SpawnT
 	return SNew(SDockTab)
 		.TabRole(ETabRole::NomadTab)
 		[
-			SNew(SPinVarPanel)
-			.OnRefreshRequested(FSimpleDelegate::CreateRaw(this, &FPinVarModule::ScanPinnedVariables))
+			Panel
 		];
 }
 
@@ -90,25 +123,95 @@ void FPinVarModule::ScanPinnedVariables()
 
 	if (UPinVarSubsystem* Subsystem = GEditor->GetEditorSubsystem<UPinVarSubsystem>())
 	{
-		Subsystem->LoadFromDisk();
-		Subsystem->MergeStagedIntoPinned();
+		Subsystem->LoadFromDisk(); // compacts the store itself
+	}
+}
+
+void FPinVarModule::OnAssetDiscovered(const FAssetData& AssetData)
+{
+	// fires for every discovered asset; keep the common path to a revision check and one map lookup,
+	// and do nothing at all (not even parse the pins) while the tab is closed
+	if (!PanelWeak.IsValid()) return;
+	UPinVarSubsystem* Subsystem = GEditor ? GEditor->GetEditorSubsystem<UPinVarSubsystem>() : nullptr;
+	if (!Subsystem) return;
+
+	if (!bWantedAssetNamesBuilt || WantedAssetsRevision != Subsystem->GetPinsRevision())
+	{
+		Subsystem->EnsurePinsLoaded();
+		WantedAssetClasses.Reset();
+		for (const TPair<FName, TArray<FPinnedVariable>>& Pair : Subsystem->StagedPinnedGroups)
+		{
+			FString Name = Pair.Key.ToString();
+			Name.RemoveFromEnd(TEXT("_C"), ESearchCase::CaseSensitive); // BP asset name of a generated class
+			WantedAssetClasses.FindOrAdd(FName(*Name)).AddUnique(Pair.Key);
+			for (const FPinnedVariable& E : Pair.Value)
+			{
+				if (!E.AssetPath.IsNull())
+				{
+					WantedAssetClasses.FindOrAdd(FName(*E.AssetPath.GetAssetName())).AddUnique(Pair.Key);
+				}
+			}
+		}
+		WantedAssetsRevision = Subsystem->GetPinsRevision();
+		bWantedAssetNamesBuilt = true;
+	}
+
+	if (const TArray<FName>* Classes = WantedAssetClasses.Find(AssetData.AssetName))
+	{
+		DiscoveredClasses.Append(*Classes);
+		ScheduleDiscoveryRefresh();
 	}
 }
 
-bool FPinVarModule::InitialRefreshOnce(float)
+void FPinVarModule::OnAssetDiscoveryFinished()
 {
-	if (!GEditor) return true; // keep trying until editor is up
+	UnbindAssetRegistry();
+	WantedAssetClasses.Empty();
+	bWantedAssetNamesBuilt = false;
+
+	// pins still waiting on the scan now resolve or turn broken, which changes the panel's layout
+	if (PanelWeak.IsValid())
+	{
+		bFullDiscoveryRefresh = true;
+		ScheduleDiscoveryRefresh();
+	}
+}
 
+void FPinVarModule::ScheduleDiscoveryRefresh()
+{
+	// coalesce bursts of discoveries into one refresh
+	if (DiscoveryRefreshHandle.IsValid()) return;
+	DiscoveryRefreshHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateRaw(this, &FPinVarModule::RefreshForDiscovery), 0.5f);
+}
+
+bool FPinVarModule::RefreshForDiscovery(float)
+{
+	DiscoveryRefreshHandle.Reset();
+	const TSet<FName> Classes = MoveTemp(DiscoveredClasses);
+	DiscoveredClasses.Reset();
+	const bool bFull = bFullDiscoveryRefresh;
+	bFullDiscoveryRefresh = false;
+
+	// RefreshClasses swaps only the matched sections, and falls back to a rebuild when a class needs a new one
 	if (TSharedPtr<SPinVarPanel> P = PanelWeak.Pin())
 	{
-		P->Refresh(); // Refresh() -> OnRefreshRequested.Execute()
+		if (bFull) { P->Refresh(); }
+		else { P->RefreshClasses(Classes); }
 	}
-	else
+	return false; // one-shot
+}
+
+void FPinVarModule::UnbindAssetRegistry()
+{
+	FAssetRegistryModule* ARM = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry");
+	if (ARM)
 	{
-		// panel not open yet; run the bound work directly
-		ScanPinnedVariables();
+		if (AssetAddedHandle.IsValid()) { ARM->Get().OnAssetAdded().Remove(AssetAddedHandle); }
+		if (FilesLoadedHandle.IsValid()) { ARM->Get().OnFilesLoaded().Remove(FilesLoadedHandle); }
 	}
-	return false; // done
+	AssetAddedHandle.Reset();
+	FilesLoadedHandle.Reset();
 }
 
 IMPLEMENT_MODULE(FPinVarModule, PinVar)
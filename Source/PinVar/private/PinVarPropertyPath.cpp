@@ -0,0 +1,170 @@
+// PinVarPropertyPath.cpp
+#include "PinVarPropertyPath.h"
+
+bool FPinVarPropertyPath::IsNested(FName VariableName)
+{
+	const FString S = VariableName.ToString();
+	int32 Unused = INDEX_NONE;
+	return S.FindChar(TEXT('.'), Unused) || S.FindChar(TEXT('['), Unused);
+}
+
+FName FPinVarPropertyPath::GetRootName(FName VariableName)
+{
+	const FString S = VariableName.ToString();
+	const int32 End = S.FindFirstCharByPredicate([](TCHAR C) { return C == TEXT('.') || C == TEXT('['); });
+	return End == INDEX_NONE ? VariableName : FName(*S.Left(End));
+}
+
+bool FPinVarPropertyPath::Compile(const UStruct* Owner, const FString& PathString)
+{
+	Segments.Reset();
+	this->Owner = Owner;
+
+	TArray<FString> Tokens;
+	PathString.ParseIntoArray(Tokens, TEXT("."), /*CullEmpty*/ false);
+
+	const UStruct* Struct = Owner;
+	for (const FString& RawToken : Tokens)
+	{
+		if (!Struct)
+		{
+			Segments.Reset();
+			return false;
+		}
+
+		// "Name" or "Name[Index]"
+		FString Name = RawToken.TrimStartAndEnd();
+		int32 Index = INDEX_NONE;
+		int32 Open = INDEX_NONE;
+		if (Name.FindChar(TEXT('['), Open))
+		{
+			if (!Name.EndsWith(TEXT("]")) || !LexTryParseString(Index, *Name.Mid(Open + 1, Name.Len() - Open - 2))
+				|| Index < 0)
+			{
+				Segments.Reset();
+				return false;
+			}
+			Name.LeftInline(Open);
+		}
+
+		FProperty* P = FindFProperty<FProperty>(Struct, FName(*Name));
+		if (!P)
+		{
+			Segments.Reset();
+			return false;
+		}
+
+		FProperty* ValueProp = P;
+		if (Index != INDEX_NONE)
+		{
+			if (FArrayProperty* AP = CastField<FArrayProperty>(P))
+			{
+				ValueProp = AP->Inner; // range is checked per object when resolving
+			}
+			else if (Index >= P->ArrayDim)
+			{
+				Segments.Reset();
+				return false;
+			}
+		}
+		Segments.Add({P, Index});
+
+		if (const FStructProperty* SP = CastField<FStructProperty>(ValueProp))
+		{
+			Struct = SP->Struct;
+		}
+		else if (const FObjectPropertyBase* OP = CastField<FObjectPropertyBase>(ValueProp))
+		{
+			Struct = OP->PropertyClass;
+		}
+		else
+		{
+			Struct = nullptr;
+		}
+	}
+	return IsValid();
+}
+
+FProperty* FPinVarPropertyPath::GetLeafProperty() const
+{
+	if (!IsValid()) return nullptr;
+
+	const FSegment& Last = Segments.Last();
+	if (Last.ArrayIndex != INDEX_NONE)
+	{
+		if (const FArrayProperty* AP = CastField<FArrayProperty>(Last.Property))
+		{
+			return AP->Inner;
+		}
+	}
+	return Last.Property;
+}
+
+void* FPinVarPropertyPath::ResolveValuePtr(UObject* Object, UObject** OutOwner) const
+{
+	if (!Object || !IsValid()) return nullptr;
+
+	void* Container = Object;
+	UObject* Owner = Object;
+	for (int32 i = 0; i < Segments.Num(); ++i)
+	{
+		const FSegment& Seg = Segments[i];
+		FProperty* ValueProp = Seg.Property;
+		void* ValuePtr = nullptr;
+
+		if (Seg.ArrayIndex == INDEX_NONE)
+		{
+			ValuePtr = Seg.Property->ContainerPtrToValuePtr<void>(Container);
+		}
+		else if (FArrayProperty* AP = CastField<FArrayProperty>(Seg.Property))
+		{
+			FScriptArrayHelper Helper(AP, AP->ContainerPtrToValuePtr<void>(Container));
+			if (!Helper.IsValidIndex(Seg.ArrayIndex)) return nullptr;
+			ValuePtr = Helper.GetRawPtr(Seg.ArrayIndex);
+			ValueProp = AP->Inner;
+		}
+		else
+		{
+			ValuePtr = Seg.Property->ContainerPtrToValuePtr<void>(Container, Seg.ArrayIndex);
+		}
+
+		if (i == Segments.Num() - 1)
+		{
+			if (OutOwner) { *OutOwner = Owner; }
+			return ValuePtr;
+		}
+
+		if (const FObjectPropertyBase* OP = CastField<FObjectPropertyBase>(ValueProp))
+		{
+			UObject* Sub = OP->GetObjectPropertyValue(ValuePtr);
+			if (!Sub) return nullptr;
+			Container = Sub;
+			Owner = Sub;
+		}
+		else
+		{
+			Container = ValuePtr; // struct memory
+		}
+	}
+	return nullptr;
+}
+
+bool FPinVarPropertyPath::ExportValue(UObject* Object, FString& OutText) const
+{
+	UObject* Owner = nullptr;
+	void* ValuePtr = ResolveValuePtr(Object, &Owner);
+	if (!ValuePtr) return false;
+
+	OutText.Reset();
+	GetLeafProperty()->ExportTextItem_Direct(OutText, ValuePtr, nullptr, Owner, PPF_None);
+	return true;
+}
+
+bool FPinVarPropertyPath::ImportValue(UObject* Object, const FString& Text) const
+{
+	UObject* Owner = nullptr;
+	void* ValuePtr = ResolveValuePtr(Object, &Owner);
+	if (!ValuePtr) return false;
+
+	return GetLeafProperty()->ImportText_Direct(*Text, ValuePtr, Owner, PPF_None) != nullptr;
+}
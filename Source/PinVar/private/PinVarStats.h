@@ -0,0 +1,36 @@
+// PinVarStats.h
+#pragma once
+
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+// `stat PinVar` in the editor; the cycle stats also show up as timing events in Unreal Insights.
+// Finer-grained work (per group / per property row) uses TRACE_CPUPROFILER_EVENT_SCOPE only.
+DECLARE_STATS_GROUP(TEXT("PinVar"), STATGROUP_PinVar, STATCAT_Advanced);
+
+// subsystem
+DECLARE_CYCLE_STAT_EXTERN(TEXT("LoadFromDisk"), STAT_PinVar_LoadFromDisk, STATGROUP_PinVar, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("SaveToDisk"), STAT_PinVar_SaveToDisk, STATGROUP_PinVar, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("SaveToDisk - Source Control"), STAT_PinVar_SourceControl, STATGROUP_PinVar, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("MergeStagedIntoPinned"), STAT_PinVar_Merge, STATGROUP_PinVar, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("RepopulateSessionCacheAll"), STAT_PinVar_Repopulate, STATGROUP_PinVar, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ApplyValueBatch"), STAT_PinVar_ApplyValueBatch, STATGROUP_PinVar, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Value Preset"), STAT_PinVar_Preset, STATGROUP_PinVar, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Values CSV"), STAT_PinVar_ValuesCsv, STATGROUP_PinVar, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Validate Pins (time-sliced)"), STAT_PinVar_Validate, STATGROUP_PinVar, );
+
+// panel / table
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Panel Refresh"), STAT_PinVar_Refresh, STATGROUP_PinVar, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Panel Rebuild"), STAT_PinVar_Rebuild, STATGROUP_PinVar, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Panel Refresh Classes"), STAT_PinVar_RefreshClasses, STATGROUP_PinVar, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GatherPinnedProperties"), STAT_PinVar_Gather, STATGROUP_PinVar, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Resolve Class"), STAT_PinVar_ResolveClass, STATGROUP_PinVar, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Find Component Template"), STAT_PinVar_FindComponentTemplate, STATGROUP_PinVar, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Table Refresh"), STAT_PinVar_TableRefresh, STATGROUP_PinVar, );
+
+// per-frame counters
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Pins Resolved"), STAT_PinVar_PinsResolved, STATGROUP_PinVar, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Assets Load Requested"), STAT_PinVar_AssetsRequested, STATGROUP_PinVar, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Assets Loaded"), STAT_PinVar_AssetsLoaded, STATGROUP_PinVar, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Assets Prefetched"), STAT_PinVar_AssetsPrefetched, STATGROUP_PinVar, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Property Widgets Created"), STAT_PinVar_WidgetsCreated, STATGROUP_PinVar, );
@@ -7,177 +7,1476 @@
 #include "Engine/SCS_Node.h"
 #include "Blueprint/BlueprintSupport.h"
 #include "Engine/BlueprintGeneratedClass.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/Blueprint.h"
+#include "Components/ActorComponent.h"
+#include "Editor.h"
+#include "ScopedTransaction.h"
+#include "Misc/TransactionObjectEvent.h"
+#include "Misc/Change.h"
+#include "Async/Async.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "PinVarCsv.h"
+#include "PinVarStats.h"
 
-bool UPinVarSubsystem::ContainsTriple(const TArray<FPinnedVariable>& Arr, FName Var, FName Group, FName Comp)
+// one recorded pin edit on the editor undo stack; holds only the pins it touched
+class FPinVarPinChange : public FCommandChange
 {
-	for (const FPinnedVariable& E : Arr)
+public:
+	explicit FPinVarPinChange(TArray<FPinVarPinDelta>&& InDeltas) : Deltas(MoveTemp(InDeltas)) {}
+
+	virtual void Apply(UObject* Object) override
+	{
+		if (UPinVarSubsystem* Subsystem = Cast<UPinVarSubsystem>(Object)) Subsystem->ApplyPinDeltas(Deltas, false);
+	}
+
+	virtual void Revert(UObject* Object) override
+	{
+		if (UPinVarSubsystem* Subsystem = Cast<UPinVarSubsystem>(Object)) Subsystem->ApplyPinDeltas(Deltas, true);
+	}
+
+	virtual FString ToString() const override
+	{
+		return FString::Printf(TEXT("PinVar: %d pin(s) changed"), Deltas.Num());
+	}
+
+private:
+	TArray<FPinVarPinDelta> Deltas;
+};
+
+int32 FPinnedVariable::AddGroups(const TArray<int32>& InGroupIds)
+{
+	int32 Added = 0;
+	for (const int32 Id : InGroupIds)
+	{
+		if (Id == 0 || GroupIds.Contains(Id)) continue;
+		GroupIds.Add(Id);
+		++Added;
+	}
+	return Added;
+}
+
+FPinnedVariable* UPinVarSubsystem::FindPin(TArray<FPinnedVariable>& Arr, const FPinKey& Key)
+{
+	return Arr.FindByPredicate([&Key](const FPinnedVariable& E) { return FPinKey(E) == Key; });
+}
+
+void UPinVarSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// pin edits are recorded on the undo buffer against the subsystem
+	SetFlags(RF_Transactional);
+
+	// startup cost is a background parse; resolving waits for the first consumer (EnsureResolved)
+	PendingParse = Async(EAsyncExecution::ThreadPool, [FilePath = GetActivePinsFilePath()]()
+	{
+		FPinVarPinsFile Parsed;
+		ParsePinsFile(FilePath, Parsed);
+		return Parsed;
+	});
+
+	// compiled property paths hold FProperty pointers that a compile or reinstance frees
+	ObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddLambda(
+		[](const TMap<UObject*, UObject*>&) { InvalidatePropertyPaths(); });
+	if (GEditor)
+	{
+		BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddStatic(&UPinVarSubsystem::InvalidatePropertyPaths);
+	}
+
+	// value edits made outside PinVar, and undo/redo of any edit
+	PropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddUObject(
+		this, &UPinVarSubsystem::OnObjectPropertyChanged);
+	ObjectTransactedHandle = FCoreUObjectDelegates::OnObjectTransacted.AddUObject(
+		this, &UPinVarSubsystem::OnObjectTransacted);
+	PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject(
+		this, &UPinVarSubsystem::PruneValueSerials);
+}
+
+void UPinVarSubsystem::Deinitialize()
+{
+	if (PendingParse.IsValid())
+	{
+		PendingParse.Wait();
+		PendingParse.Reset();
+	}
+	FCoreUObjectDelegates::OnObjectsReplaced.Remove(ObjectsReplacedHandle);
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(PropertyChangedHandle);
+	FCoreUObjectDelegates::OnObjectTransacted.Remove(ObjectTransactedHandle);
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+	if (GEditor)
+	{
+		GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+	}
+	if (ValidationTicker.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(ValidationTicker);
+		ValidationTicker.Reset();
+	}
+	ReleaseLoadHandle(ValidationLoadHandle);
+	if (FilesLoadedHandle.IsValid())
+	{
+		if (FAssetRegistryModule* ARM = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+		{
+			ARM->Get().OnFilesLoaded().Remove(FilesLoadedHandle);
+		}
+		FilesLoadedHandle.Reset();
+	}
+	Super::Deinitialize();
+}
+
+void UPinVarSubsystem::EnsurePinsLoaded()
+{
+	if (!PendingParse.IsValid()) return;
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(PinVar_EnsurePinsLoaded);
+	FPinVarPinsFile Parsed = PendingParse.Consume(); // blocks only if still parsing
+	PendingParse.Reset();
+	InstallParsedPins(MoveTemp(Parsed));
+}
+
+void UPinVarSubsystem::EnsureResolved()
+{
+	EnsurePinsLoaded();
+	if (bSessionResolved) return;
+
+	bSessionResolved = true;
+	RepopulateSessionCacheAll();
+	RequestValidation();
+}
+
+void UPinVarSubsystem::RequestValidation()
+{
+	EnsurePinsLoaded();
+	IAssetRegistry& AR = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	if (AR.IsLoadingAssets())
+	{
+		// a missing class only means something once discovery is complete
+		if (!FilesLoadedHandle.IsValid())
+		{
+			FilesLoadedHandle = AR.OnFilesLoaded().AddUObject(this, &UPinVarSubsystem::StartValidationPass);
+		}
+		return;
+	}
+	StartValidationPass();
+}
+
+void UPinVarSubsystem::StartValidationPass()
+{
+	if (FilesLoadedHandle.IsValid())
+	{
+		FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get().OnFilesLoaded().Remove(
+			FilesLoadedHandle);
+		FilesLoadedHandle.Reset();
+	}
+
+	// restarting mid-pass just requeues everything; pins keep their last state until revisited
+	StagedPinnedGroups.GenerateKeyArray(ValidationQueue);
+	bValidationIndexBuilt = false;
+	ReleaseLoadHandle(ValidationLoadHandle);
+
+	if (!ValidationTicker.IsValid())
+	{
+		ValidationTicker = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &UPinVarSubsystem::TickValidation));
+	}
+}
+
+bool UPinVarSubsystem::TickValidation(float)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PinVar_Validate);
+
+	// keep each editor frame cheap; a bucket is never split across ticks
+	constexpr double BudgetSeconds = 0.002;
+	const double Deadline = FPlatformTime::Seconds() + BudgetSeconds;
+
+	if (!bValidationIndexBuilt)
+	{
+		BuildGeneratedClassIndex(ValidationClassIndex);
+		bValidationIndexBuilt = true;
+
+		// classes not in memory yet come in as one async batch; nothing loads inside the budget
+		TArray<FSoftObjectPath> ToLoad;
+		for (const FName ClassName : ValidationQueue)
+		{
+			if (FindLoadedClass(ClassName)) continue;
+			const FString Name = ClassName.ToString();
+			const FName GenName(Name.EndsWith(TEXT("_C")) ? Name : Name + TEXT("_C"));
+			if (const FSoftObjectPath* Path = ValidationClassIndex.Find(GenName))
+			{
+				ToLoad.Add(*Path);
+			}
+		}
+		if (ToLoad.Num() > 0)
+		{
+			ValidationLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(ToLoad);
+		}
+	}
+	if (ValidationLoadHandle.IsValid() && ValidationLoadHandle->IsLoadingInProgress())
+	{
+		return true;
+	}
+
+	while (ValidationQueue.Num() > 0 && FPlatformTime::Seconds() < Deadline)
+	{
+		const FName ClassName = ValidationQueue.Pop(EAllowShrinking::No);
+		TArray<FPinnedVariable>* Vars = StagedPinnedGroups.Find(ClassName);
+		if (!Vars) continue;
+
+		// a class the batch could not load is missing; component pins need their templates first
+		UClass* Cls = FindLoadedClass(ClassName);
+		RepopulateClassEntries(ClassName, *Vars);
+		for (const FPinnedVariable& E : *Vars)
+		{
+			GetPinState(ClassName, FPinKey(E)).ResolveState = ValidatePin(ClassName, Cls, E);
+		}
+	}
+
+	if (ValidationQueue.Num() > 0)
+	{
+		return true;
+	}
+
+	ValidationTicker.Reset();
+	ValidationClassIndex.Reset();
+	ReleaseLoadHandle(ValidationLoadHandle);
+
+	const int32 NumBroken = GetNumBrokenPins();
+	if (NumBroken > 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("PinVar: %d pinned variables no longer resolve."), NumBroken);
+	}
+	OnPinsValidated.Broadcast();
+	return false;
+}
+
+EPinVarResolveResult UPinVarSubsystem::ValidatePin(FName ClassName, UClass* Class, const FPinnedVariable& Pin) const
+{
+	if (!Pin.AssetPath.IsNull() && !Pin.AssetPath.ResolveObject())
+	{
+		// not resident: the registry tells a deleted asset from an unloaded one without loading it
+		const FAssetData AD = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get()
+			.GetAssetByObjectPath(Pin.AssetPath);
+		if (!AD.IsValid()) return EPinVarResolveResult::MissingAsset;
+
+		// only checkable when the asset's class is already in memory
+		if (const UClass* AssetClass = AD.GetClass())
+		{
+			return GetPinPropertyPath(Pin, AssetClass).IsValid()
+				       ? EPinVarResolveResult::Ok
+				       : EPinVarResolveResult::MissingProperty;
+		}
+		return EPinVarResolveResult::Ok;
+	}
+
+	UObject* Target = nullptr;
+	FProperty* Prop = nullptr;
+	return ResolvePin(ClassName, Class, Pin, Target, Prop);
+}
+
+int32 UPinVarSubsystem::GetNumBrokenPins() const
+{
+	int32 N = 0;
+	for (const TPair<FName, TArray<FPinnedVariable>>& Pair : StagedPinnedGroups)
+	{
+		for (const FPinnedVariable& E : Pair.Value)
+		{
+			if (IsBrokenPin(GetResolveState(Pair.Key, E))) ++N;
+		}
+	}
+	return N;
+}
+
+FPinVarPinState& UPinVarSubsystem::GetPinState(FName ClassName, const FPinKey& Key)
+{
+	return PinStates.FindOrAdd(TPair<FName, FPinKey>(ClassName, Key));
+}
+
+const FPinVarPinState* UPinVarSubsystem::FindPinState(FName ClassName, const FPinnedVariable& Pin) const
+{
+	return PinStates.Find(TPair<FName, FPinKey>(ClassName, FPinKey(Pin)));
+}
+
+EPinVarResolveResult UPinVarSubsystem::GetResolveState(FName ClassName, const FPinnedVariable& Pin) const
+{
+	const FPinVarPinState* State = FindPinState(ClassName, Pin);
+	return State ? State->ResolveState : EPinVarResolveResult::Unknown;
+}
+
+UObject* UPinVarSubsystem::GetResolvedTemplate(FName ClassName, const FPinnedVariable& Pin) const
+{
+	const FPinVarPinState* State = FindPinState(ClassName, Pin);
+	return State ? State->ResolvedTemplate.Get() : nullptr;
+}
+
+
+void UPinVarSubsystem::StagePinVariable(FName ClassName, FName VariableName, FName GroupName,
+                                        FName ComponentTemplateName)
+{
+	EnsurePinsLoaded();
+	TArray<int32> Ids;
+	GroupTable.AddPathList(GroupName.ToString(), Ids);
+	NotePinTouched(ClassName, FPinKey(VariableName, ComponentTemplateName, FSoftObjectPath()));
+	TArray<FPinnedVariable>& Vars = StagedPinnedGroups.FindOrAdd(ClassName);
+	if (FPinnedVariable* Existing = FindPin(Vars, FPinKey(VariableName, ComponentTemplateName, FSoftObjectPath())))
+	{
+		Existing->AddGroups(Ids);
+	}
+	else
+	{
+		Vars.Add(FPinnedVariable(VariableName, MoveTemp(Ids), ComponentTemplateName));
+	}
+}
+
+
+void UPinVarSubsystem::StagePinVariableWithTemplate(FName ClassName, FName VariableName, FName GroupName,
+                                                    FName ComponentTemplateName, UObject* TemplatePtr,
+                                                    FName ComponentVariablePrettyName)
+{
+	EnsurePinsLoaded();
+	TArray<int32> Ids;
+	GroupTable.AddPathList(GroupName.ToString(), Ids);
+	NotePinTouched(ClassName, FPinKey(VariableName, ComponentTemplateName, FSoftObjectPath()));
+	TArray<FPinnedVariable>& Vars = StagedPinnedGroups.FindOrAdd(ClassName);
+	const FPinKey Key(VariableName, ComponentTemplateName, FSoftObjectPath());
+	if (FPinnedVariable* Existing = FindPin(Vars, Key))
+	{
+		Existing->AddGroups(Ids);
+	}
+	else
+	{
+		Vars.Add(FPinnedVariable(VariableName, MoveTemp(Ids), ComponentTemplateName, ComponentVariablePrettyName));
+	}
+	FPinVarPinState& State = GetPinState(ClassName, Key);
+	if (!State.ResolvedTemplate.IsValid()) State.ResolvedTemplate = TemplatePtr;
+}
+
+int32 UPinVarSubsystem::StagePinBatch(FName ClassName, const TArray<FPinnedVariable>& Entries)
+{
+	EnsurePinsLoaded();
+	TArray<FPinnedVariable>& Vars = StagedPinnedGroups.FindOrAdd(ClassName);
+
+	// hash the bucket once instead of a linear scan per entry
+	TMap<FPinKey, int32> Existing;
+	Existing.Reserve(Vars.Num() + Entries.Num());
+	for (int32 i = 0; i < Vars.Num(); ++i)
+	{
+		Existing.Add(FPinKey(Vars[i]), i);
+	}
+
+	int32 Added = 0;
+	for (const FPinnedVariable& E : Entries)
+	{
+		if (E.VariableName.IsNone() || E.GroupIds.Num() == 0) continue;
+		NotePinTouched(ClassName, FPinKey(E));
+
+		if (const int32* Index = Existing.Find(FPinKey(E)))
+		{
+			// already pinned: only the membership is new
+			if (Vars[*Index].AddGroups(E.GroupIds) > 0) ++Added;
+			continue;
+		}
+
+		Existing.Add(FPinKey(E), Vars.Add(E));
+		++Added;
+	}
+
+	if (Vars.Num() == 0)
+	{
+		StagedPinnedGroups.Remove(ClassName);
+	}
+	return Added;
+}
+
+bool UPinVarSubsystem::UnstagePinVariable(FName ClassName, FName VariableName, int32 GroupId,
+                                          FName ComponentTemplateName, const FSoftObjectPath& AssetPath)
+{
+	EnsurePinsLoaded();
+	if (TArray<FPinnedVariable>* Vars = StagedPinnedGroups.Find(ClassName))
+	{
+		const int32 Index = Vars->IndexOfByPredicate(
+			[Key = FPinKey(VariableName, ComponentTemplateName, AssetPath)](const FPinnedVariable& E)
+			{
+				return FPinKey(E) == Key;
+			});
+		if (Index == INDEX_NONE) return false;
+
+		NotePinTouched(ClassName, FPinKey(VariableName, ComponentTemplateName, AssetPath));
+		FPinnedVariable& E = (*Vars)[Index];
+		if (GroupId != 0)
+		{
+			const int32 Target = GroupTable.Resolve(GroupId);
+			if (E.GroupIds.RemoveAll([this, Target](const int32 Id) { return GroupTable.Resolve(Id) == Target; }) == 0)
+			{
+				return false;
+			}
+		}
+		if (GroupId == 0 || E.GroupIds.Num() == 0)
+		{
+			Vars->RemoveAt(Index);
+		}
+
+		if (Vars->Num() == 0)
+		{
+			StagedPinnedGroups.Remove(ClassName);
+		}
+		return true;
+	}
+	return false;
+}
+
+void UPinVarSubsystem::MergeStagedIntoPinned()
+{
+	SCOPE_CYCLE_COUNTER(STAT_PinVar_Merge);
+	EnsurePinsLoaded();
+
+	// compacts in place: drops incomplete entries and the slack left by staging, and folds duplicates
+	// (older files stored one entry per group) into a single pin that carries every membership.
+	// data asset entries keep only their path; the panel loads them when their rows are shown
+	TMap<FPinKey, int32> Seen;
+	TSet<int32> UsedGroups;
+	int32 NumPins = 0;
+	for (auto It = StagedPinnedGroups.CreateIterator(); It; ++It)
+	{
+		TArray<FPinnedVariable>& Arr = It.Value();
+		Seen.Reset();
+		int32 Write = 0;
+		for (int32 Read = 0; Read < Arr.Num(); ++Read)
+		{
+			FPinnedVariable& E = Arr[Read];
+			E.GroupIds.RemoveAll([this](const int32 Id) { return GroupTable.Resolve(Id) == 0; });
+			if (E.VariableName.IsNone() || E.GroupIds.Num() == 0) continue;
+			UsedGroups.Append(E.GroupIds);
+
+			if (const int32* Kept = Seen.Find(FPinKey(E)))
+			{
+				Arr[*Kept].AddGroups(E.GroupIds);
+				continue;
+			}
+			Seen.Add(FPinKey(E), Write);
+			if (Write != Read) Arr[Write] = MoveTemp(E);
+			++Write;
+		}
+		Arr.SetNum(Write, EAllowShrinking::No);
+		NumPins += Write;
+
+		if (Arr.Num() == 0)
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+		Arr.Shrink();
+	}
+	StagedPinnedGroups.Compact();
+	GroupTable.RemoveUnused(UsedGroups);
+
+	// state of pins that are gone; at most one state per pin, so only walked when some must be stale
+	if (PinStates.Num() > NumPins)
+	{
+		TMap<FName, TSet<FPinKey>> Live;
+		for (auto It = PinStates.CreateIterator(); It; ++It)
+		{
+			TSet<FPinKey>* Keys = Live.Find(It.Key().Key);
+			if (!Keys)
+			{
+				Keys = &Live.Add(It.Key().Key);
+				if (const TArray<FPinnedVariable>* Arr = StagedPinnedGroups.Find(It.Key().Key))
+				{
+					for (const FPinnedVariable& E : *Arr) { Keys->Add(FPinKey(E)); }
+				}
+			}
+			if (!Keys->Contains(It.Key().Value)) It.RemoveCurrent();
+		}
+	}
+	++PinsRevision;
+}
+
+void UPinVarSubsystem::NotePinTouched(FName ClassName, const FPinKey& Key)
+{
+	if (PinTransactionDepth == 0) return;
+
+	const TPair<FName, FPinKey> NoteKey(ClassName, Key);
+	if (PinTransactionDeltas.Contains(NoteKey)) return;
+
+	FPinVarPinDelta& D = PinTransactionDeltas.Add(NoteKey);
+	D.ClassName = ClassName;
+	D.Pin.VariableName = Key.VariableName;
+	D.Pin.ComponentTemplateName = Key.ComponentTemplateName;
+	D.Pin.AssetPath = Key.AssetPath;
+	if (TArray<FPinnedVariable>* Vars = StagedPinnedGroups.Find(ClassName))
+	{
+		if (const FPinnedVariable* E = FindPin(*Vars, Key))
+		{
+			D.GroupsBefore = E->GroupIds;
+			D.Pin.ComponentVariablePrettyName = E->ComponentVariablePrettyName;
+			// paths now: a merge inside the scope may prune groups this pin was the last member of
+			for (const int32 Id : D.GroupsBefore) { D.PathsBefore.Add(GroupTable.GetPath(Id)); }
+		}
+	}
+}
+
+void UPinVarSubsystem::BeginPinTransaction()
+{
+	EnsurePinsLoaded();
+	++PinTransactionDepth;
+}
+
+void UPinVarSubsystem::EndPinTransaction(const FText& Description)
+{
+	if (PinTransactionDepth == 0 || --PinTransactionDepth > 0) return;
+
+	TArray<FPinVarPinDelta> Deltas;
+	Deltas.Reserve(PinTransactionDeltas.Num());
+	for (TPair<TPair<FName, FPinKey>, FPinVarPinDelta>& Pair : PinTransactionDeltas)
+	{
+		FPinVarPinDelta& D = Pair.Value;
+		if (TArray<FPinnedVariable>* Vars = StagedPinnedGroups.Find(D.ClassName))
+		{
+			if (const FPinnedVariable* E = FindPin(*Vars, Pair.Key.Value))
+			{
+				D.GroupsAfter = E->GroupIds;
+				D.Pin.ComponentVariablePrettyName = E->ComponentVariablePrettyName;
+			}
+		}
+		if (D.GroupsBefore == D.GroupsAfter) continue;
+
+		for (const int32 Id : D.GroupsAfter) { D.PathsAfter.Add(GroupTable.GetPath(Id)); }
+		Deltas.Add(MoveTemp(D));
+	}
+	PinTransactionDeltas.Reset();
+	if (Deltas.Num() == 0) return;
+
+	FScopedTransaction Transaction(Description);
+	if (GUndo)
+	{
+		GUndo->StoreUndo(this, MakeUnique<FPinVarPinChange>(MoveTemp(Deltas)));
+	}
+}
+
+void UPinVarSubsystem::ApplyPinDeltas(const TArray<FPinVarPinDelta>& Deltas, bool bRevert)
+{
+	EnsurePinsLoaded();
+
+	TSet<FName> Classes;
+	for (const FPinVarPinDelta& D : Deltas)
+	{
+		const TArray<int32>& Ids = bRevert ? D.GroupsBefore : D.GroupsAfter;
+		const TArray<FString>& Paths = bRevert ? D.PathsBefore : D.PathsAfter;
+		TArray<int32> Groups;
+		for (int32 i = 0; i < Ids.Num(); ++i)
+		{
+			int32 Id = GroupTable.Resolve(Ids[i]);
+			if (Id == 0 && Paths.IsValidIndex(i)) Id = GroupTable.FindOrAddPath(Paths[i]);
+			if (Id != 0) Groups.AddUnique(Id);
+		}
+
+		TArray<FPinnedVariable>& Vars = StagedPinnedGroups.FindOrAdd(D.ClassName);
+		const FPinKey Key(D.Pin);
+		const int32 Index = Vars.IndexOfByPredicate([&Key](const FPinnedVariable& E) { return FPinKey(E) == Key; });
+		if (Groups.Num() == 0)
+		{
+			if (Index != INDEX_NONE) Vars.RemoveAt(Index);
+		}
+		else if (Index != INDEX_NONE)
+		{
+			Vars[Index].GroupIds = MoveTemp(Groups);
+		}
+		else
+		{
+			Vars.Add_GetRef(D.Pin).GroupIds = MoveTemp(Groups);
+		}
+		if (Vars.Num() == 0) StagedPinnedGroups.Remove(D.ClassName);
+		Classes.Add(D.ClassName);
+	}
+
+	MergeStagedIntoPinned();
+	SaveToDisk();
+	OnPinsChanged.Broadcast(Classes);
+}
+
+FPinVarPinTransaction::FPinVarPinTransaction(UPinVarSubsystem* InSubsystem, const FText& InDescription)
+	: Subsystem(InSubsystem)
+	  , Description(InDescription)
+{
+	if (InSubsystem) InSubsystem->BeginPinTransaction();
+}
+
+FPinVarPinTransaction::~FPinVarPinTransaction()
+{
+	if (UPinVarSubsystem* S = Subsystem.Get()) S->EndPinTransaction(Description);
+}
+
+bool UPinVarSubsystem::RenameGroup(int32 GroupId, FName NewName)
+{
+	EnsurePinsLoaded();
+	if (!GroupTable.Rename(GroupId, NewName)) return false;
+
+	// renaming onto an existing sibling merges, which changes the tree rather than a label
+	OnGroupsChanged.Broadcast(GroupId, GroupTable.Resolve(GroupId) == GroupId);
+	return true;
+}
+
+bool UPinVarSubsystem::MoveGroup(int32 GroupId, int32 NewParentId)
+{
+	EnsurePinsLoaded();
+	if (!GroupTable.Move(GroupId, NewParentId)) return false;
+
+	OnGroupsChanged.Broadcast(GroupId, false);
+	return true;
+}
+
+bool UPinVarSubsystem::MergeGroups(int32 FromId, int32 IntoId)
+{
+	EnsurePinsLoaded();
+	if (!GroupTable.Merge(FromId, IntoId)) return false;
+
+	OnGroupsChanged.Broadcast(FromId, false);
+	return true;
+}
+
+void UPinVarSubsystem::RepopulateSessionCacheAll()
+{
+	SCOPE_CYCLE_COUNTER(STAT_PinVar_Repopulate);
+	EnsurePinsLoaded();
+
+	for (auto& Pair : StagedPinnedGroups)
+	{
+		RepopulateClassEntries(Pair.Key, Pair.Value);
+	}
+}
+
+void UPinVarSubsystem::RepopulateSessionCache(FName ClassName)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PinVar_Repopulate);
+
+	if (TArray<FPinnedVariable>* Entries = StagedPinnedGroups.Find(ClassName))
+	{
+		RepopulateClassEntries(ClassName, *Entries);
+	}
+}
+
+void UPinVarSubsystem::RepopulateClassEntries(FName ClassName, TArray<FPinnedVariable>& Entries)
+{
+	UClass* Cls = FindLoadedClass(ClassName);
+	if (!Cls) return;
+
+	for (FPinnedVariable& E : Entries)
+	{
+		if (!E.ComponentTemplateName.IsNone())
+		{
+			UObject* Found = nullptr;
+
+			// Try CDO first
+			if (UObject* CDO = Cls->GetDefaultObject(true))
+			{
+				Found = CDO->GetDefaultSubobjectByName(E.ComponentTemplateName);
+			}
+
+			// Try SCS pretty name
+			if (!Found && !E.ComponentVariablePrettyName.IsNone())
+			{
+				for (UClass* C = Cls; C; C = C->GetSuperClass())
+				{
+					UBlueprintGeneratedClass* BPGC = Cast<UBlueprintGeneratedClass>(C);
+					if (!BPGC) continue;
+
+					UBlueprint* OwnerBP = Cast<UBlueprint>(BPGC->ClassGeneratedBy);
+					if (!OwnerBP) continue;
+
+					USimpleConstructionScript* SCS = OwnerBP->SimpleConstructionScript;
+					if (!SCS) continue;
+
+					for (USCS_Node* Node : SCS->GetAllNodes())
+					{
+						if (!Node || Node->GetVariableName() != E.ComponentVariablePrettyName) continue;
+
+						Found = Node->GetActualComponentTemplate(BPGC);
+						if (!Found)
+						{
+							Found = Node->ComponentTemplate;
+						}
+						break;
+					}
+					if (Found) break;
+				}
+			}
+
+			GetPinState(ClassName, FPinKey(E)).ResolvedTemplate = Found;
+			if (Found) { INC_DWORD_STAT(STAT_PinVar_PinsResolved); }
+		}
+	}
+}
+
+int32 UPinVarSubsystem::ApplyValueBatch(const TArray<FPinVarValueWrite>& Writes, const FText& TransactionText)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PinVar_ApplyValueBatch);
+
+	using FPathWrite = TPair<TSharedPtr<const FPinVarPropertyPath>, const FString*>;
+
+	// object -> (path, value) so every object gets a single Modify / Pre / Post round
+	TMap<UObject*, TArray<FPathWrite>> ByObject;
+	for (const FPinVarValueWrite& W : Writes)
+	{
+		UObject* Obj = W.Target.Get();
+		if (!Obj) continue;
+
+		TSharedPtr<const FPinVarPropertyPath> Path = FindPropertyPath(Obj->GetClass(), W.VariableName);
+		if (!Path.IsValid()) continue;
+
+		ByObject.FindOrAdd(Obj).Emplace(MoveTemp(Path), &W.ValueText);
+	}
+	if (ByObject.Num() == 0) return 0;
+
+	const FScopedTransaction Transaction(TransactionText);
+
+	TSet<UPackage*> TouchedPackages;
+	int32 Applied = 0;
+	for (TPair<UObject*, TArray<FPathWrite>>& Pair : ByObject)
+	{
+		UObject* Obj = Pair.Key;
+		Obj->Modify(/*bAlwaysMarkDirty*/ false);
+
+		// nested paths notify through their top-level property
+		for (const FPathWrite& Write : Pair.Value)
+		{
+			Obj->PreEditChange(Write.Key->GetRootProperty());
+		}
+		for (const FPathWrite& Write : Pair.Value)
+		{
+			UObject* Owner = nullptr;
+			if (Write.Key->ResolveValuePtr(Obj, &Owner) && Owner != Obj)
+			{
+				Owner->Modify(/*bAlwaysMarkDirty*/ false); // value lives on a referenced sub-object
+			}
+
+			if (Write.Key->ImportValue(Obj, *Write.Value))
+			{
+				++Applied;
+			}
+			else
+			{
+				UE_LOG(LogTemp, Warning, TEXT("PinVar: ApplyValueBatch - could not import '%s' into %s.%s"),
+				       **Write.Value, *Obj->GetName(), *Write.Key->GetLeafProperty()->GetName());
+			}
+		}
+		for (const FPathWrite& Write : Pair.Value)
+		{
+			FPropertyChangedEvent Event(Write.Key->GetRootProperty(), EPropertyChangeType::ValueSet);
+			Obj->PostEditChangeProperty(Event);
+		}
+
+		TouchedPackages.Add(Obj->GetOutermost());
+	}
+
+	for (UPackage* Package : TouchedPackages)
+	{
+		Package->MarkPackageDirty();
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("PinVar: applied %d values on %d objects (%d packages)."),
+	       Applied, ByObject.Num(), TouchedPackages.Num());
+	return Applied;
+}
+
+UObject* UPinVarSubsystem::LoadPinTarget(FName ClassName, UClass* Class, const FPinnedVariable& Pin) const
+{
+	if (!Pin.AssetPath.IsNull())
+	{
+		return Pin.AssetPath.TryLoad();
+	}
+	UObject* CDO = Class ? Class->GetDefaultObject(true) : nullptr;
+	if (!CDO || Pin.ComponentTemplateName.IsNone()) return CDO;
+
+	UObject* Template = GetResolvedTemplate(ClassName, Pin);
+	return Template ? Template : FindComponentTemplate(Class, Pin.ComponentTemplateName);
+}
+
+FString UPinVarSubsystem::GetPresetsDir()
+{
+	return FPaths::Combine(FPaths::ProjectDir(), TEXT("PinVar"), TEXT("Presets"));
+}
+
+void UPinVarSubsystem::GetPresetNames(TArray<FString>& OutNames)
+{
+	OutNames.Reset();
+	IFileManager::Get().FindFiles(OutNames, *FPaths::Combine(GetPresetsDir(), TEXT("*.json")), true, false);
+	for (FString& Name : OutNames) { Name = FPaths::GetBaseFilename(Name); }
+	OutNames.Sort();
+}
+
+int32 UPinVarSubsystem::SavePreset(int32 GroupId, const FString& PresetName)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PinVar_Preset);
+	EnsurePinsLoaded();
+
+	GroupId = GroupTable.Resolve(GroupId);
+	const FString FileName = FPaths::MakeValidFileName(PresetName.TrimStartAndEnd());
+	if (GroupId == 0 || FileName.IsEmpty()) return 0;
+
+	auto IsInGroup = [this, GroupId](const FPinnedVariable& E)
+	{
+		return E.GroupIds.ContainsByPredicate([this, GroupId](const int32 Id)
+		{
+			const int32 Resolved = GroupTable.Resolve(Id);
+			return Resolved == GroupId || GroupTable.IsAncestorOf(GroupId, Resolved);
+		});
+	};
+
+	TSet<FSoftObjectPath> ToLoad;
+	for (const TPair<FName, TArray<FPinnedVariable>>& Pair : StagedPinnedGroups)
+	{
+		for (const FPinnedVariable& E : Pair.Value)
+		{
+			if (!E.AssetPath.IsNull() && !E.AssetPath.ResolveObject() && IsInGroup(E)) ToLoad.Add(E.AssetPath);
+		}
+	}
+	LoadAssetsBatched(ToLoad.Array());
+
+	// {"Version", "Group": path, "Values": class -> [{Var, Comp?, Asset?, Value}]}
+	TSharedRef<FJsonObject> JValues = MakeShared<FJsonObject>();
+	int32 Captured = 0;
+	FString Text;
+	for (const TPair<FName, TArray<FPinnedVariable>>& Pair : StagedPinnedGroups)
+	{
+		UClass* Cls = nullptr;
+		bool bClassLooked = false;
+
+		TArray<TSharedPtr<FJsonValue>> JArr;
+		for (const FPinnedVariable& E : Pair.Value)
+		{
+			if (!IsInGroup(E)) continue;
+
+			if (!bClassLooked)
+			{
+				Cls = ResolveClassByName(Pair.Key);
+				bClassLooked = true;
+			}
+			UObject* Target = LoadPinTarget(Pair.Key, Cls, E);
+			const TSharedPtr<const FPinVarPropertyPath> Path =
+				Target ? GetPinPropertyPath(E, Target->GetClass()) : nullptr;
+			if (!Path.IsValid() || !Path->ExportValue(Target, Text)) continue;
+
+			TSharedRef<FJsonObject> J = MakeShared<FJsonObject>();
+			J->SetStringField(TEXT("Var"), E.VariableName.ToString());
+			if (!E.ComponentTemplateName.IsNone())
+			{
+				J->SetStringField(TEXT("Comp"), E.ComponentTemplateName.ToString());
+			}
+			if (!E.AssetPath.IsNull())
+			{
+				J->SetStringField(TEXT("Asset"), E.AssetPath.ToString());
+			}
+			J->SetStringField(TEXT("Value"), Text);
+			JArr.Add(MakeShared<FJsonValueObject>(J));
+		}
+		if (JArr.Num() > 0)
+		{
+			Captured += JArr.Num();
+			JValues->SetArrayField(Pair.Key.ToString(), JArr);
+		}
+	}
+	if (Captured == 0) return 0;
+
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetNumberField(TEXT("Version"), 1);
+	Root->SetStringField(TEXT("Group"), GroupTable.GetPath(GroupId));
+	Root->SetObjectField(TEXT("Values"), JValues);
+
+	FString OutStr;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutStr);
+	const FString FilePath = FPaths::Combine(GetPresetsDir(), FileName + TEXT(".json"));
+	IFileManager::Get().MakeDirectory(*GetPresetsDir(), /*Tree*/true);
+	if (!FJsonSerializer::Serialize(Root, Writer) ||
+		!FFileHelper::SaveStringToFile(OutStr, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogTemp, Error, TEXT("PinVar: SavePreset - could not write %s"), *FilePath);
+		return 0;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("PinVar: saved preset '%s' (%d values)."), *FileName, Captured);
+	return Captured;
+}
+
+int32 UPinVarSubsystem::ApplyPreset(const FString& PresetName)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PinVar_Preset);
+
+	const FString FilePath = FPaths::Combine(GetPresetsDir(), FPaths::MakeValidFileName(PresetName) + TEXT(".json"));
+	FString InStr;
+	TSharedPtr<FJsonObject> Root;
+	const TSharedPtr<FJsonObject>* JValues = nullptr;
+	if (!FFileHelper::LoadFileToString(InStr, *FilePath) ||
+		!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(InStr), Root) || !Root.IsValid() ||
+		!Root->TryGetObjectField(TEXT("Values"), JValues))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("PinVar: ApplyPreset - could not read %s"), *FilePath);
+		return 0;
+	}
+
+	TSet<FSoftObjectPath> ToLoad;
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& KVP : (*JValues)->Values)
+	{
+		const TArray<TSharedPtr<FJsonValue>>* JArr = nullptr;
+		if (!KVP.Value.IsValid() || !KVP.Value->TryGetArray(JArr)) continue;
+		for (const TSharedPtr<FJsonValue>& V : *JArr)
+		{
+			const TSharedPtr<FJsonObject>* J = nullptr;
+			FString Asset;
+			if (!V.IsValid() || !V->TryGetObject(J) || !(*J)->TryGetStringField(TEXT("Asset"), Asset)) continue;
+
+			const FSoftObjectPath AssetPath(Asset);
+			if (!AssetPath.IsNull() && !AssetPath.ResolveObject()) ToLoad.Add(AssetPath);
+		}
+	}
+	LoadAssetsBatched(ToLoad.Array());
+
+	// values that already match are skipped, so switching between close presets touches few objects
+	TArray<FPinVarValueWrite> Writes;
+	FString Current;
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& KVP : (*JValues)->Values)
+	{
+		const TArray<TSharedPtr<FJsonValue>>* JArr = nullptr;
+		if (!KVP.Value.IsValid() || !KVP.Value->TryGetArray(JArr)) continue;
+
+		UClass* Cls = ResolveClassByName(FName(*KVP.Key));
+		for (const TSharedPtr<FJsonValue>& V : *JArr)
+		{
+			const TSharedPtr<FJsonObject>* J = nullptr;
+			if (!V.IsValid() || !V->TryGetObject(J)) continue;
+
+			FString Var, Comp, Asset, Value;
+			(*J)->TryGetStringField(TEXT("Var"), Var);
+			(*J)->TryGetStringField(TEXT("Comp"), Comp);
+			(*J)->TryGetStringField(TEXT("Asset"), Asset);
+			if (Var.IsEmpty() || !(*J)->TryGetStringField(TEXT("Value"), Value)) continue;
+
+			const FPinnedVariable Pin(FName(*Var), {}, Comp.IsEmpty() ? NAME_None : FName(*Comp), NAME_None,
+			                          FSoftObjectPath(Asset));
+			UObject* Target = LoadPinTarget(FName(*KVP.Key), Cls, Pin);
+			const TSharedPtr<const FPinVarPropertyPath> Path =
+				Target ? FindPropertyPath(Target->GetClass(), Pin.VariableName) : nullptr;
+			if (!Path.IsValid())
+			{
+				UE_LOG(LogTemp, Warning, TEXT("PinVar: ApplyPreset - %s.%s no longer resolves."), *KVP.Key, *Var);
+				continue;
+			}
+			if (Path->ExportValue(Target, Current) && Current == Value) continue;
+
+			Writes.Add(FPinVarValueWrite{Target, Pin.VariableName, MoveTemp(Value)});
+		}
+	}
+	if (Writes.Num() == 0) return 0;
+
+	return ApplyValueBatch(Writes, FText::FromString(FString::Printf(TEXT("PinVar: Apply Preset %s"), *PresetName)));
+}
+
+void UPinVarSubsystem::LoadAssetsBatched(const TArray<FSoftObjectPath>& Paths)
+{
+	if (Paths.Num() == 0) return;
+
+	UE_LOG(LogTemp, Display, TEXT("PinVar: loading %d assets..."), Paths.Num());
+	const TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(Paths);
+	if (Handle.IsValid())
+	{
+		Handle->WaitUntilComplete();
+	}
+}
+
+void UPinVarSubsystem::ReleaseLoadHandle(TSharedPtr<FStreamableHandle>& Handle)
+{
+	if (!Handle.IsValid()) return;
+
+	if (Handle->IsLoadingInProgress())
 	{
-		if (E.VariableName == Var && E.GroupName == Group && E.ComponentTemplateName == Comp)
-			return true;
+		Handle->CancelHandle();
 	}
-	return false;
+	else
+	{
+		Handle->ReleaseHandle();
+	}
+	Handle.Reset();
 }
 
-void UPinVarSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+namespace PinVarCsv
 {
-	Super::Initialize(Collection);
-
-	LoadFromDisk();
-	MergeStagedIntoPinned();
-	RepopulateSessionCacheAll();
+	const TCHAR* Header = TEXT("Class,Property,Component,Asset,Groups,Value");
 }
 
+FString UPinVarSubsystem::GetValuesCsvPath()
+{
+	return FPaths::Combine(FPaths::ProjectDir(), TEXT("PinVar"), TEXT("Values.csv"));
+}
 
-void UPinVarSubsystem::StagePinVariable(FName ClassName, FName VariableName, FName GroupName,
-                                        FName ComponentTemplateName)
+int32 UPinVarSubsystem::ExportValuesCsv(const FString& FilePath)
 {
-	TArray<FPinnedVariable>& Vars = StagedPinnedGroups.FindOrAdd(ClassName);
-	if (!ContainsTriple(Vars, VariableName, GroupName, ComponentTemplateName))
+	SCOPE_CYCLE_COUNTER(STAT_PinVar_ValuesCsv);
+	EnsurePinsLoaded();
+
+	TSet<FSoftObjectPath> ToLoad;
+	for (const TPair<FName, TArray<FPinnedVariable>>& Pair : StagedPinnedGroups)
+	{
+		for (const FPinnedVariable& E : Pair.Value)
+		{
+			if (!E.AssetPath.IsNull() && !E.AssetPath.ResolveObject()) ToLoad.Add(E.AssetPath);
+		}
+	}
+	LoadAssetsBatched(ToLoad.Array());
+
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*FilePath));
+	if (!Writer)
 	{
-		Vars.Add(FPinnedVariable(VariableName, GroupName, ComponentTemplateName));
+		UE_LOG(LogTemp, Error, TEXT("PinVar: ExportValuesCsv - could not open %s"), *FilePath);
+		return INDEX_NONE;
 	}
-	
-	
-}
+	auto WriteLine = [&Writer](const FString& Line)
+	{
+		const FTCHARToUTF8 Utf8(*(Line + LINE_TERMINATOR));
+		Writer->Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Utf8.Length());
+	};
+	WriteLine(PinVarCsv::Header);
 
+	TMap<FName, FSoftObjectPath> ClassIndex;
+	BuildGeneratedClassIndex(ClassIndex);
 
-void UPinVarSubsystem::StagePinVariableWithTemplate(FName ClassName, FName VariableName, FName GroupName,
-                                                    FName ComponentTemplateName, UObject* TemplatePtr,
-                                                    FName ComponentVariablePrettyName)
+	int32 Rows = 0;
+	FString Line;
+	FString Value;
+	for (const TPair<FName, TArray<FPinnedVariable>>& Pair : StagedPinnedGroups)
+	{
+		UClass* Cls = ResolveClassByName(Pair.Key, &ClassIndex);
+		for (const FPinnedVariable& E : Pair.Value)
+		{
+			UObject* Target = LoadPinTarget(Pair.Key, Cls, E);
+			const TSharedPtr<const FPinVarPropertyPath> Path =
+				Target ? GetPinPropertyPath(E, Target->GetClass()) : nullptr;
+			if (!Path.IsValid() || !Path->ExportValue(Target, Value)) continue;
+
+			Line.Reset();
+			PinVarCsv::AppendField(Line, Pair.Key.ToString());
+			PinVarCsv::AppendField(Line, E.VariableName.ToString());
+			PinVarCsv::AppendField(Line, E.ComponentTemplateName.IsNone() ? FString() : E.ComponentTemplateName.ToString());
+			PinVarCsv::AppendField(Line, E.AssetPath.ToString());
+			PinVarCsv::AppendField(Line, GroupTable.GetPathList(E.GroupIds));
+			PinVarCsv::AppendField(Line, Value);
+			WriteLine(Line);
+			++Rows;
+		}
+	}
+
+	if (!Writer->Close())
+	{
+		UE_LOG(LogTemp, Error, TEXT("PinVar: ExportValuesCsv - write failed: %s"), *FilePath);
+		return INDEX_NONE;
+	}
+	UE_LOG(LogTemp, Display, TEXT("PinVar: exported %d values to %s."), Rows, *FilePath);
+	return Rows;
+}
+
+bool UPinVarSubsystem::ReadValuesCsv(const FString& FilePath, TArray<FPinVarValueChange>& OutChanges,
+                                     int32& OutRowsRead, int32& OutRowsSkipped)
 {
-	TArray<FPinnedVariable>& Vars = StagedPinnedGroups.FindOrAdd(ClassName);
-	if (!ContainsTriple(Vars, VariableName, GroupName, ComponentTemplateName))
+	SCOPE_CYCLE_COUNTER(STAT_PinVar_ValuesCsv);
+	EnsurePinsLoaded();
+
+	OutChanges.Reset();
+	OutRowsRead = 0;
+	OutRowsSkipped = 0;
+
+	// (class, pin identity) -> pin; only pinned targets can be written
+	TMap<TPair<FName, FPinKey>, const FPinnedVariable*> PinIndex;
+	for (const TPair<FName, TArray<FPinnedVariable>>& Pair : StagedPinnedGroups)
+	{
+		for (const FPinnedVariable& E : Pair.Value)
+		{
+			PinIndex.Add(TPair<FName, FPinKey>(Pair.Key, FPinKey(E)), &E);
+		}
+	}
+
+	struct FRow
+	{
+		FName ClassName;
+		const FPinnedVariable* Pin;
+		FString Value;
+	};
+	TArray<FRow> Rows;
+	TSet<FSoftObjectPath> ToLoad;
+	TArray<FString> Fields;
+	bool bHeader = true;
+	// a quoted value with line breaks spans several lines; they are joined back into one record
+	FString Record;
+	bool bInQuotes = false;
+	const bool bRead = FFileHelper::LoadFileToStringWithLineVisitor(*FilePath, [&](FStringView Line)
+	{
+		if (bInQuotes)
+		{
+			Record.AppendChar(TEXT('\n'));
+			Record.Append(Line.GetData(), Line.Len());
+		}
+		else
+		{
+			if (bHeader) { bHeader = false; return; }
+			if (Line.IsEmpty()) return;
+			Record = FString(Line);
+		}
+		for (const TCHAR C : Line)
+		{
+			if (C == TEXT('"')) bInQuotes = !bInQuotes; // a doubled quote flips twice
+		}
+		if (bInQuotes) return;
+
+		++OutRowsRead;
+		PinVarCsv::SplitLine(Record, Fields);
+		if (Fields.Num() < 6)
+		{
+			++OutRowsSkipped;
+			return;
+		}
+
+		const FName ClassName(*Fields[0]);
+		const FPinKey Key(FName(*Fields[1]), Fields[2].IsEmpty() ? NAME_None : FName(*Fields[2]),
+		                  FSoftObjectPath(Fields[3]));
+		const FPinnedVariable* const* Pin = PinIndex.Find(TPair<FName, FPinKey>(ClassName, Key));
+		if (!Pin)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("PinVar: ReadValuesCsv - %s.%s is not pinned; row skipped."),
+			       *Fields[0], *Fields[1]);
+			++OutRowsSkipped;
+			return;
+		}
+		if (!Key.AssetPath.IsNull() && !Key.AssetPath.ResolveObject()) ToLoad.Add(Key.AssetPath);
+		Rows.Add({ClassName, *Pin, MoveTemp(Fields[5])});
+	});
+	if (!bRead)
 	{
-		FPinnedVariable E(VariableName, GroupName, ComponentTemplateName, ComponentVariablePrettyName);
-		E.ResolvedTemplate = TemplatePtr;
-		Vars.Add(MoveTemp(E));
+		UE_LOG(LogTemp, Warning, TEXT("PinVar: ReadValuesCsv - could not read %s"), *FilePath);
+		return false;
+	}
+	if (bInQuotes)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("PinVar: ReadValuesCsv - unterminated quoted value at the end of %s; row skipped."),
+		       *FilePath);
+		++OutRowsRead;
+		++OutRowsSkipped;
+	}
+
+	LoadAssetsBatched(ToLoad.Array());
+
+	TMap<FName, UClass*> Classes;
+	TMap<FName, FSoftObjectPath> ClassIndex;
+	FString Current;
+	for (FRow& Row : Rows)
+	{
+		UClass** Cls = Classes.Find(Row.ClassName);
+		if (!Cls)
+		{
+			if (ClassIndex.Num() == 0) BuildGeneratedClassIndex(ClassIndex);
+			Cls = &Classes.Add(Row.ClassName, ResolveClassByName(Row.ClassName, &ClassIndex));
+		}
+
+		UObject* Target = LoadPinTarget(Row.ClassName, *Cls, *Row.Pin);
+		const TSharedPtr<const FPinVarPropertyPath> Path =
+			Target ? GetPinPropertyPath(*Row.Pin, Target->GetClass()) : nullptr;
+		if (!Path.IsValid() || !Path->ExportValue(Target, Current))
+		{
+			++OutRowsSkipped;
+			continue;
+		}
+		if (Current == Row.Value) continue;
+
+		FPinVarValueChange& Change = OutChanges.AddDefaulted_GetRef();
+		Change.Write = FPinVarValueWrite{Target, Row.Pin->VariableName, MoveTemp(Row.Value)};
+		Change.ClassName = Row.ClassName;
+		Change.OldValue = Current;
 	}
-	
+
+	UE_LOG(LogTemp, Display, TEXT("PinVar: read %d rows from %s; %d differ, %d skipped."),
+	       OutRowsRead, *FilePath, OutChanges.Num(), OutRowsSkipped);
+	return true;
 }
 
-bool UPinVarSubsystem::UnstagePinVariable(FName ClassName, FName VariableName, FName GroupName,
-                                          FName ComponentTemplateName)
+const TCHAR* LexToString(EPinVarResolveResult Result)
 {
-	if (TArray<FPinnedVariable>* Vars = StagedPinnedGroups.Find(ClassName))
+	switch (Result)
 	{
-		const int32 Removed = Vars->RemoveAll(
-			[VariableName, GroupName, ComponentTemplateName](const FPinnedVariable& E)
-			{
-				return E.VariableName == VariableName
-					&& E.GroupName == GroupName
-					&& E.ComponentTemplateName == ComponentTemplateName;
-			});
+	case EPinVarResolveResult::Unknown: return TEXT("Unknown");
+	case EPinVarResolveResult::Ok: return TEXT("Ok");
+	case EPinVarResolveResult::MissingClass: return TEXT("MissingClass");
+	case EPinVarResolveResult::MissingComponent: return TEXT("MissingComponent");
+	case EPinVarResolveResult::MissingProperty: return TEXT("MissingProperty");
+	case EPinVarResolveResult::MissingAsset: return TEXT("MissingAsset");
+	}
+	return TEXT("Unknown");
+}
 
-		if (Vars->Num() == 0)
+void UPinVarSubsystem::BuildGeneratedClassIndex(TMap<FName, FSoftObjectPath>& OutIndex)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(PinVar_BuildGeneratedClassIndex);
+	OutIndex.Reset();
+
+	FAssetRegistryModule& ARM = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+
+	FARFilter Filter;
+	Filter.bRecursiveClasses = true;
+	Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+
+	TArray<FAssetData> Assets;
+	ARM.Get().GetAssets(Filter, Assets);
+
+	OutIndex.Reserve(Assets.Num());
+	for (const FAssetData& AD : Assets)
+	{
+		FString PathStr;
+		if (AD.GetTagValue(FBlueprintTags::GeneratedClassPath, PathStr) && !PathStr.IsEmpty())
 		{
-			StagedPinnedGroups.Remove(ClassName);
+			OutIndex.Add(FName(*FPackageName::ObjectPathToObjectName(PathStr)), FSoftObjectPath(PathStr));
 		}
-		return Removed > 0;
 	}
-	return false;
 }
 
-void UPinVarSubsystem::MergeStagedIntoPinned()
+UClass* UPinVarSubsystem::FindLoadedClass(FName ClassName)
+{
+	const FString InName = ClassName.ToString();
+	if (UClass* C = FindFirstObjectSafe<UClass>(*InName))
+	{
+		return C;
+	}
+	return InName.EndsWith(TEXT("_C")) ? nullptr : FindFirstObjectSafe<UClass>(*(InName + TEXT("_C")));
+}
+
+UClass* UPinVarSubsystem::ResolveClassByName(FName ClassName, const TMap<FName, FSoftObjectPath>* GeneratedClassIndex)
 {
-	const TMap<FName, TArray<FPinnedVariable>> Original = StagedPinnedGroups; // keep a copy
-	StagedPinnedGroups.Empty();
+	SCOPE_CYCLE_COUNTER(STAT_PinVar_ResolveClass);
 
-	for (const TPair<FName, TArray<FPinnedVariable>>& Pair : Original)
+	if (UClass* C = FindLoadedClass(ClassName))
 	{
-		const FName ClassName = Pair.Key;
+		return C;
+	}
 
-		for (const FPinnedVariable& E : Pair.Value)
+	const FString InName = ClassName.ToString();
+	const FString WantedGenName = InName.EndsWith(TEXT("_C")) ? InName : (InName + TEXT("_C"));
+
+	if (GeneratedClassIndex)
+	{
+		const FSoftObjectPath* Path = GeneratedClassIndex->Find(FName(*WantedGenName));
+		return Path ? Cast<UClass>(Path->TryLoad()) : nullptr;
+	}
+
+	FAssetRegistryModule& ARM = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+
+	FARFilter Filter;
+	Filter.bRecursiveClasses = true;
+	Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+
+	TArray<FAssetData> Assets;
+	ARM.Get().GetAssets(Filter, Assets);
+
+	for (const FAssetData& AD : Assets)
+	{
+		// UE5 tag: GeneratedClassPath (string form works across versions)
+		FString PathStr;
+		if (AD.GetTagValue(FBlueprintTags::GeneratedClassPath, PathStr) && !PathStr.IsEmpty())
 		{
-			// Data Asset entry
-			if (!E.AssetPath.IsNull())
+			if (FPackageName::ObjectPathToObjectName(PathStr) == WantedGenName)
 			{
-				UObject* Instance = E.AssetPath.ResolveObject();
-				if (!Instance) { Instance = E.AssetPath.TryLoad(); }
-				if (Instance)
-				{
-					StagePinVariableForDataAsset(ClassName, E.VariableName, E.GroupName, Instance);
-				}
-				continue;
+				UClass* C = FindObject<UClass>(nullptr, *PathStr);
+				if (!C) { C = LoadObject<UClass>(nullptr, *PathStr); }
+				if (C) { return C; }
+			}
+			continue;
+		}
+		// Fallback for assets saved without the tag: load BP and use its GeneratedClass
+		if (UBlueprint* BP = Cast<UBlueprint>(AD.GetAsset()))
+		{
+			if (BP->GeneratedClass && BP->GeneratedClass->GetName() == WantedGenName)
+			{
+				return BP->GeneratedClass;
 			}
+		}
+	}
+
+	return nullptr;
+}
+
+UObject* UPinVarSubsystem::FindComponentTemplate(UClass* Class, FName TemplateName)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PinVar_FindComponentTemplate);
+
+	if (!Class || TemplateName.IsNone()) return nullptr;
+
+	const FName Alt(*(TemplateName.ToString() + TEXT("_GEN_VARIABLE")));
+
+	// Walk this class and all supers
+	for (UClass* C = Class; C; C = C->GetSuperClass())
+	{
+		if (UObject* CDO = C->GetDefaultObject(true))
+		{
+			if (UObject* T = CDO->GetDefaultSubobjectByName(TemplateName)) return T;
+			if (UObject* T2 = CDO->GetDefaultSubobjectByName(Alt)) return T2;
 
-			// Component entry (template or pretty name)
-			if (!E.ComponentTemplateName.IsNone() || E.ResolvedTemplate.IsValid())
+			TArray<UObject*> Subs;
+			GetObjectsWithOuter(CDO, Subs, true);
+			for (UObject* O : Subs)
 			{
-				StagePinVariableWithTemplate(
-					ClassName,
-					E.VariableName,
-					E.GroupName,
-					E.ComponentTemplateName,
-					E.ResolvedTemplate.Get(),
-					E.ComponentVariablePrettyName
-				);
-				continue;
+				if (!O) continue;
+				const FName N = O->GetFName();
+				if (N == TemplateName || N == Alt)
+					return O;
 			}
+		}
+	}
+
+	// Blueprint-added components: the construction scripts up the chain, resolved against the
+	// most-derived class so an inherited component's override is returned
+	UBlueprintGeneratedClass* ActualBPGC = Cast<UBlueprintGeneratedClass>(Class);
+	for (UClass* C = Class; C; C = C->GetSuperClass())
+	{
+		UBlueprintGeneratedClass* BPGC = Cast<UBlueprintGeneratedClass>(C);
+		if (!BPGC) continue;
+		UBlueprint* OwnerBP = Cast<UBlueprint>(BPGC->ClassGeneratedBy);
+		if (!OwnerBP || !OwnerBP->SimpleConstructionScript) continue;
+
+		for (USCS_Node* Node : OwnerBP->SimpleConstructionScript->GetAllNodes())
+		{
+			if (!Node) continue;
+
+			UActorComponent* Template = Node->GetActualComponentTemplate(ActualBPGC ? ActualBPGC : BPGC);
+			if (!Template) Template = Node->ComponentTemplate;
+			if (!Template) continue;
 
-			// Class default (no component/asset)
-			StagePinVariable(ClassName, E.VariableName, E.GroupName, NAME_None);
+			const FName N = Template->GetFName();
+			if (N == TemplateName || N == Alt || Node->GetVariableName() == TemplateName)
+				return Template;
 		}
 	}
+	return nullptr;
+}
+
+EPinVarResolveResult UPinVarSubsystem::ResolvePin(FName ClassName, UClass* Class, const FPinnedVariable& Pin,
+                                                  UObject*& OutTarget, FProperty*& OutProperty) const
+{
+	OutTarget = nullptr;
+	OutProperty = nullptr;
+
+	UObject* CDO = Class ? Class->GetDefaultObject(true) : nullptr;
+	if (!CDO) return EPinVarResolveResult::MissingClass;
+
+	UObject* Target = CDO;
+	if (!Pin.AssetPath.IsNull())
+	{
+		Target = Pin.AssetPath.ResolveObject();
+		if (!Target) return EPinVarResolveResult::MissingAsset;
+	}
+	if (!Pin.ComponentTemplateName.IsNone())
+	{
+		Target = GetResolvedTemplate(ClassName, Pin);
+		if (!Target) Target = FindComponentTemplate(Class, Pin.ComponentTemplateName);
+		if (!Target) return EPinVarResolveResult::MissingComponent;
+	}
 
-	// Mirror the freshly-restaged set into PinnedGroups
-	PinnedGroups = StagedPinnedGroups;
+	const TSharedPtr<const FPinVarPropertyPath> Path = GetPinPropertyPath(Pin, Target->GetClass());
+	if (!Path.IsValid()) return EPinVarResolveResult::MissingProperty;
 
-	// Restore original staged map
-	StagedPinnedGroups = Original;
+	OutTarget = Target;
+	OutProperty = Path->GetLeafProperty();
+	return EPinVarResolveResult::Ok;
 }
 
-void UPinVarSubsystem::RepopulateSessionCacheAll()
+bool UPinVarSubsystem::GetUnloadedValuePreview(const FSoftObjectPath& AssetPath, FName VariableName, FString& OutValue)
 {
-	for (auto& Pair : StagedPinnedGroups)
+	if (AssetPath.IsNull() || FPinVarPropertyPath::IsNested(VariableName)) return false;
+
+	const IAssetRegistry& AR = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	const FAssetData Data = AR.GetAssetByObjectPath(AssetPath);
+	return Data.IsValid() && Data.GetTagValue(VariableName, OutValue);
+}
+
+namespace PinVarPaths
+{
+	// failed compiles are cached too (as null) so dead pins are not re-parsed on every refresh
+	TMap<TPair<TWeakObjectPtr<const UStruct>, FName>, TSharedPtr<const FPinVarPropertyPath>> Cache;
+}
+
+TSharedPtr<const FPinVarPropertyPath> UPinVarSubsystem::FindPropertyPath(const UStruct* Owner, FName VariableName)
+{
+	if (!Owner || VariableName.IsNone()) return nullptr;
+
+	const TPair<TWeakObjectPtr<const UStruct>, FName> Key(Owner, VariableName);
+	if (const TSharedPtr<const FPinVarPropertyPath>* Cached = PinVarPaths::Cache.Find(Key))
 	{
-		const FName ClassName = Pair.Key;
-		UClass* Cls = FindFirstObjectSafe<UClass>(*ClassName.ToString());
-		if (!Cls) continue;
+		return *Cached;
+	}
 
-		for (FPinnedVariable& E : Pair.Value)
-		{
-			if (!E.ComponentTemplateName.IsNone())
-			{
-				UObject* Found = nullptr;
+	TSharedPtr<FPinVarPropertyPath> Path = MakeShared<FPinVarPropertyPath>();
+	if (!Path->Compile(Owner, VariableName.ToString()))
+	{
+		Path.Reset();
+	}
+	PinVarPaths::Cache.Add(Key, Path);
+	return Path;
+}
 
-				// Try CDO first
-				if (UObject* CDO = Cls->GetDefaultObject(true))
-				{
-					Found = CDO->GetDefaultSubobjectByName(E.ComponentTemplateName);
-				}
+TSharedPtr<const FPinVarPropertyPath> UPinVarSubsystem::GetPinPropertyPath(const FPinnedVariable& Pin,
+                                                                          const UStruct* Owner)
+{
+	return FindPropertyPath(Owner, Pin.VariableName);
+}
 
-				// Try SCS pretty name
-				if (!Found && !E.ComponentVariablePrettyName.IsNone())
-				{
-					for (UClass* C = Cls; C; C = C->GetSuperClass())
-					{
-						UBlueprintGeneratedClass* BPGC = Cast<UBlueprintGeneratedClass>(C);
-						if (!BPGC) continue;
+void UPinVarSubsystem::InvalidatePropertyPaths()
+{
+	PinVarPaths::Cache.Reset();
+}
 
-						UBlueprint* OwnerBP = Cast<UBlueprint>(BPGC->ClassGeneratedBy);
-						if (!OwnerBP) continue;
+uint32 UPinVarSubsystem::GetValueSerial(const UObject* Object, FName RootProperty)
+{
+	if (!Object) return 0;
+	// the object-wide entry is always there so a property-less change can be seen by every watcher
+	TMap<FName, uint32>& ByProperty = ValueSerials.FindOrAdd(FObjectKey(Object));
+	const uint32 ObjectSerial = ByProperty.FindOrAdd(NAME_None);
+	return ObjectSerial + (RootProperty.IsNone() ? 0 : ByProperty.FindOrAdd(RootProperty));
+}
 
-						USimpleConstructionScript* SCS = OwnerBP->SimpleConstructionScript;
-						if (!SCS) continue;
+void UPinVarSubsystem::BumpValueSerial(const UObject* Object, FName RootProperty)
+{
+	// unwatched objects cost one hash lookup
+	TMap<FName, uint32>* ByProperty = ValueSerials.Find(FObjectKey(Object));
+	if (!ByProperty) return;
 
-						for (USCS_Node* Node : SCS->GetAllNodes())
-						{
-							if (!Node || Node->GetVariableName() != E.ComponentVariablePrettyName) continue;
-
-							Found = Node->GetActualComponentTemplate(BPGC);
-							if (!Found)
-							{
-								Found = Node->ComponentTemplate;
-							}
-							break;
-						}
-						if (Found) break;
-					}
-				}
+	if (uint32* Serial = ByProperty->Find(RootProperty))
+	{
+		++*Serial;
+	}
+}
 
-				E.ResolvedTemplate = Found;
-			}
-		}
+void UPinVarSubsystem::PruneValueSerials()
+{
+	// a collected object's key never resolves again (its slot's serial moves on), so its counters are dead weight
+	for (auto It = ValueSerials.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().ResolveObjectPtr()) It.RemoveCurrent();
+	}
+}
+
+void UPinVarSubsystem::OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event)
+{
+	// MemberProperty is the top-level property even when a nested member was edited
+	const FProperty* Changed = Event.MemberProperty ? Event.MemberProperty : Event.Property;
+	BumpValueSerial(Object, Changed ? Changed->GetFName() : NAME_None);
+}
+
+void UPinVarSubsystem::OnObjectTransacted(UObject* Object, const FTransactionObjectEvent& Event)
+{
+	if (Event.GetEventType() != ETransactionObjectEventType::UndoRedo) return;
+
+	const TArray<FName>& Changed = Event.GetChangedProperties();
+	if (Changed.Num() == 0)
+	{
+		BumpValueSerial(Object, NAME_None);
+		return;
+	}
+	for (const FName Name : Changed)
+	{
+		BumpValueSerial(Object, Name);
 	}
 }
 
@@ -188,10 +1487,20 @@ FString UPinVarSubsystem::GetPinsFilePath()
 	return FPaths::Combine(Dir, TEXT("Pinned.json"));
 }
 
+FString UPinVarSubsystem::GetActivePinsFilePath() const
+{
+	return PinsFileOverride.IsEmpty() ? GetPinsFilePath() : PinsFileOverride;
+}
+
 bool UPinVarSubsystem::SaveToDisk() const
 {
+	SCOPE_CYCLE_COUNTER(STAT_PinVar_SaveToDisk);
+	if (PendingParse.IsValid())
+	{
+		return true; // never loaded this session, so the file on disk is already current
+	}
 	UE_LOG(LogTemp, Display, TEXT("SaveToDisk"));
-	const FString FilePath = GetPinsFilePath();
+	const FString FilePath = GetActivePinsFilePath();
 	const FString Dir = FPaths::GetPath(FilePath);
 
 	IPlatformFile& PF = FPlatformFileManager::Get().GetPlatformFile();
@@ -204,7 +1513,14 @@ bool UPinVarSubsystem::SaveToDisk() const
 		}
 	}
 
+	// version 2: {"Version", "Groups": id -> record, "Pins": class -> entries referencing group ids}
 	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	TSharedRef<FJsonObject> JGroups = MakeShared<FJsonObject>();
+	TSharedRef<FJsonObject> JPins = MakeShared<FJsonObject>();
+	GroupTable.Write(*JGroups);
+	Root->SetNumberField(TEXT("Version"), PinsFileVersion);
+	Root->SetObjectField(TEXT("Groups"), JGroups);
+	Root->SetObjectField(TEXT("Pins"), JPins);
 	for (const auto& Pair : StagedPinnedGroups)
 	{
 		const FString ClassKey = Pair.Key.ToString();
@@ -214,12 +1530,16 @@ bool UPinVarSubsystem::SaveToDisk() const
 		JArr.Reserve(Arr.Num());
 		for (const FPinnedVariable& E : Arr)
 		{
-			if (E.VariableName.IsNone() || E.GroupName.IsNone())
+			if (E.VariableName.IsNone() || E.GroupIds.Num() == 0)
 				continue;
 
+			TArray<TSharedPtr<FJsonValue>> JIds;
+			JIds.Reserve(E.GroupIds.Num());
+			for (const int32 Id : E.GroupIds) { JIds.Add(MakeShared<FJsonValueNumber>(Id)); }
+
 			TSharedRef<FJsonObject> J = MakeShared<FJsonObject>();
 			J->SetStringField(TEXT("Var"), E.VariableName.ToString());
-			J->SetStringField(TEXT("Group"), E.GroupName.ToString());
+			J->SetArrayField(TEXT("Groups"), JIds);
 			if (!E.ComponentTemplateName.IsNone())
 			{
 				J->SetStringField(TEXT("Comp"), E.ComponentTemplateName.ToString());
@@ -234,13 +1554,15 @@ bool UPinVarSubsystem::SaveToDisk() const
 			}
 			JArr.Add(MakeShared<FJsonValueObject>(J));
 		}
-		Root->SetArrayField(ClassKey, JArr);
+		JPins->SetArrayField(ClassKey, JArr);
 	}
 
 	FString OutStr;
 	{
-		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
-			TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&OutStr);
+		TRACE_CPUPROFILER_EVENT_SCOPE(PinVar_SaveToDisk_Serialize);
+		// pretty-printed so a group edit only touches that record's lines in a source control diff
+		TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> Writer =
+			TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&OutStr);
 
 		if (!FJsonSerializer::Serialize(Root, Writer))
 		{
@@ -257,6 +1579,7 @@ bool UPinVarSubsystem::SaveToDisk() const
 
 	if (bSCEnabled && Provider && bFileExists)
 	{
+		SCOPE_CYCLE_COUNTER(STAT_PinVar_SourceControl);
 		Provider->Execute(ISourceControlOperation::Create<FUpdateStatus>(), FilePath);
 		if (FSourceControlStatePtr State = Provider->GetState(FilePath, EStateCacheUsage::Use))
 		{
@@ -275,6 +1598,7 @@ bool UPinVarSubsystem::SaveToDisk() const
 			}
 		}
 	}
+	TRACE_CPUPROFILER_EVENT_SCOPE(PinVar_SaveToDisk_Write);
 	const bool bSaved = FFileHelper::SaveStringToFile(OutStr, *FilePath,
 	                                                  FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
 	if (!bSaved)
@@ -292,29 +1616,97 @@ void UPinVarSubsystem::StagePinVariableForDataAsset(FName ClassName, FName Varia
 		UE_LOG(LogTemp, Warning, TEXT("PinVar: Stage DA — invalid input."));
 		return;
 	}
-	TArray<FPinnedVariable>& Bucket = StagedPinnedGroups.FindOrAdd(ClassName);
 
-	const FString PathStr = DataAssetInstance->GetPathName();
+	StagePinVariableForAssetPaths(ClassName, VariableName, GroupName, {FSoftObjectPath(DataAssetInstance)});
+}
 
-	for (const FPinnedVariable& E : Bucket)
+int32 UPinVarSubsystem::StagePinVariableForAssetPaths(FName ClassName, FName VariableName, FName GroupName,
+                                                      const TArray<FSoftObjectPath>& AssetPaths)
+{
+	if (VariableName.IsNone() || GroupName.IsNone() || AssetPaths.Num() == 0)
 	{
-		if (E.VariableName == VariableName &&
-			E.GroupName == GroupName &&
-			E.AssetPath.ToString() == PathStr)
-		{
-			return;
-		}
+		return 0;
+	}
+
+	EnsurePinsLoaded();
+	TArray<int32> Ids;
+	GroupTable.AddPathList(GroupName.ToString(), Ids);
+
+	TArray<FPinnedVariable> Batch;
+	Batch.Reserve(AssetPaths.Num());
+	for (const FSoftObjectPath& Path : AssetPaths)
+	{
+		if (Path.IsNull()) continue;
+		Batch.Add(FPinnedVariable(VariableName, Ids, NAME_None, NAME_None, Path));
 	}
+	return StagePinBatch(ClassName, Batch);
+}
+
+int32 UPinVarSubsystem::StagePinVariableForAssetsOfClass(FName ClassName, FName VariableName, FName GroupName,
+                                                         const UClass* AssetClass)
+{
+	TArray<FSoftObjectPath> Paths;
+	GatherAssetPathsOfClass(AssetClass, Paths);
+	const int32 Added = StagePinVariableForAssetPaths(ClassName, VariableName, GroupName, Paths);
 
-	FPinnedVariable NewEntry(VariableName, GroupName);
-	NewEntry.AssetPath = FSoftObjectPath(DataAssetInstance);
+	UE_LOG(LogTemp, Display, TEXT("PinVar: pinned '%s' on %d of %d assets of %s."),
+	       *VariableName.ToString(), Added, Paths.Num(), AssetClass ? *AssetClass->GetName() : TEXT("None"));
+	return Added;
+}
+
+void UPinVarSubsystem::GatherAssetPathsOfClass(const UClass* AssetClass, TArray<FSoftObjectPath>& OutPaths)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(PinVar_GatherAssetPathsOfClass);
+	OutPaths.Reset();
+	if (!AssetClass) return;
+
+	// registry data only — nothing gets loaded here
+	FAssetRegistryModule& ARM = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
 
-	Bucket.Add(MoveTemp(NewEntry));
+	FARFilter Filter;
+	Filter.bRecursiveClasses = true;
+	Filter.ClassPaths.Add(AssetClass->GetClassPathName());
+
+	TArray<FAssetData> Assets;
+	ARM.Get().GetAssets(Filter, Assets);
+
+	OutPaths.Reserve(Assets.Num());
+	for (const FAssetData& AD : Assets)
+	{
+		OutPaths.Add(AD.GetSoftObjectPath());
+	}
+	OutPaths.Sort([](const FSoftObjectPath& A, const FSoftObjectPath& B)
+	{
+		return A.ToString() < B.ToString();
+	});
 }
 
 bool UPinVarSubsystem::LoadFromDisk()
 {
-	const FString FilePath = GetPinsFilePath();
+	SCOPE_CYCLE_COUNTER(STAT_PinVar_LoadFromDisk);
+
+	// an explicit load supersedes the startup parse (which may even be of another file)
+	if (PendingParse.IsValid())
+	{
+		PendingParse.Wait();
+		PendingParse.Reset();
+	}
+
+	FPinVarPinsFile Parsed;
+	if (!ParsePinsFile(GetActivePinsFilePath(), Parsed)) return false;
+
+	InstallParsedPins(MoveTemp(Parsed));
+	if (bSessionResolved)
+	{
+		RepopulateSessionCacheAll();
+	}
+	return true;
+}
+
+bool UPinVarSubsystem::ParsePinsFile(const FString& FilePath, FPinVarPinsFile& Out)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(PinVar_LoadFromDisk_Parse);
+
 	FString InStr;
 	if (!FPaths::FileExists(FilePath) || !FFileHelper::LoadFileToString(InStr, *FilePath)) { return false; }
 
@@ -326,10 +1718,27 @@ bool UPinVarSubsystem::LoadFromDisk()
 		return false;
 	}
 
-	StagedPinnedGroups.Empty();
+	Out.Groups.Reset();
+	Out.Pins.Reset();
+
+	// version 1 had class arrays at the root and group paths inline; they become group records here
+	int32 Version = 1;
+	Root->TryGetNumberField(TEXT("Version"), Version);
+	const TSharedPtr<FJsonObject>* JGroups = nullptr;
+	const TSharedPtr<FJsonObject>* JPins = nullptr;
+	if (Version >= 2)
+	{
+		if (!Root->TryGetObjectField(TEXT("Groups"), JGroups) || !Root->TryGetObjectField(TEXT("Pins"), JPins))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("PinVar: LoadFromDisk - version %d file without Groups/Pins: %s"),
+			       Version, *FilePath);
+			return false;
+		}
+		Out.Groups.Read(**JGroups);
+	}
 
-	int32 ClassesLoaded = 0;
-	for (const auto& KVP : Root->Values)
+	const FJsonObject& PinsRoot = JPins ? **JPins : *Root;
+	for (const auto& KVP : PinsRoot.Values)
 	{
 		const FString& ClassKey = KVP.Key;
 		const TSharedPtr<FJsonValue>& Value = KVP.Value;
@@ -338,7 +1747,8 @@ bool UPinVarSubsystem::LoadFromDisk()
 		if (!Value.IsValid() || !Value->TryGetArray(JArr) || !JArr)
 			continue;
 
-		TArray<FPinnedVariable>& Arr = StagedPinnedGroups.FindOrAdd(FName(*ClassKey));
+		TArray<FPinnedVariable>& Arr = Out.Pins.FindOrAdd(FName(*ClassKey));
+		Arr.Reserve(JArr->Num());
 		for (const TSharedPtr<FJsonValue>& JV : *JArr)
 		{
 			const TSharedPtr<FJsonObject>* ObjPtr = nullptr;
@@ -347,27 +1757,45 @@ bool UPinVarSubsystem::LoadFromDisk()
 
 			FString VarStr, GroupStr, CompStr, CompVarStr, AssetStr;
 			(*ObjPtr)->TryGetStringField(TEXT("Var"), VarStr);
-			(*ObjPtr)->TryGetStringField(TEXT("Group"), GroupStr);
 			(*ObjPtr)->TryGetStringField(TEXT("Comp"), CompStr);
 			(*ObjPtr)->TryGetStringField(TEXT("CompVar"), CompVarStr);
 			(*ObjPtr)->TryGetStringField(TEXT("Asset"), AssetStr);
 
-			if (!VarStr.IsEmpty() && !GroupStr.IsEmpty())
+			TArray<int32> Ids;
+			const TArray<TSharedPtr<FJsonValue>>* JIds = nullptr;
+			if (Version >= 2 && (*ObjPtr)->TryGetArrayField(TEXT("Groups"), JIds))
+			{
+				for (const TSharedPtr<FJsonValue>& JId : *JIds)
+				{
+					int32 Id = 0;
+					if (JId.IsValid() && JId->TryGetNumber(Id) && Id > 0) Ids.AddUnique(Id);
+				}
+			}
+			else if ((*ObjPtr)->TryGetStringField(TEXT("Group"), GroupStr))
+			{
+				Out.Groups.AddPathList(GroupStr, Ids);
+			}
+
+			if (!VarStr.IsEmpty() && Ids.Num() > 0)
 			{
 				Arr.Add(FPinnedVariable(
 					FName(*VarStr),
-					FName(*GroupStr),
+					MoveTemp(Ids),
 					CompStr.IsEmpty() ? NAME_None : FName(*CompStr),
 					CompVarStr.IsEmpty() ? NAME_None : FName(*CompVarStr),
 					FSoftObjectPath(AssetStr)
 				));
 			}
 		}
-
-		if (Arr.Num() > 0) ++ClassesLoaded;
 	}
+	return true;
+}
 
+void UPinVarSubsystem::InstallParsedPins(FPinVarPinsFile&& Parsed)
+{
+	// session state is keyed by pin identity, so unchanged pins keep theirs across a reload; the merge
+	// drops the state of pins the file no longer has
+	StagedPinnedGroups = MoveTemp(Parsed.Pins);
+	GroupTable = MoveTemp(Parsed.Groups);
 	MergeStagedIntoPinned();
-	RepopulateSessionCacheAll();
-	return true;
 }
@@ -6,10 +6,15 @@
 #include "Modules/ModuleManager.h"
 #include "Widgets/Layout/SScrollBox.h"
 #include "Widgets/Layout/SSeparator.h"
+#include "Widgets/Layout/SBox.h"
 #include "Widgets/Layout/SExpandableArea.h"
 #include "Widgets/Text/STextBlock.h"
 #include "Widgets/Input/SEditableTextBox.h"
 #include "Widgets/Input/SComboBox.h"
+#include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Input/SSearchBox.h"
+#include "Widgets/Views/SListView.h"
+#include "Widgets/Views/STableRow.h"
 #include "SSearchableComboBox.h"
 
 #include "Widgets/Input/SSegmentedControl.h"
@@ -17,6 +22,8 @@
 #include "Widgets/SWindow.h"
 
 #include "PinVarSubsystem.h"
+#include "SPinVarTable.h"
+#include "Widgets/Layout/SWidgetSwitcher.h"
 
 #include "ContentBrowserModule.h"
 #include "IContentBrowserSingleton.h"
@@ -35,6 +42,9 @@
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "UObject/StructOnScope.h"
 #include "Engine/Blueprint.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "PinVarStats.h"
 
 // Simple structs that should stay SinglePropertyView (no dropdown header)
 bool SPinVarPanel::IsSimpleStruct(const UScriptStruct* SS)
@@ -49,55 +59,6 @@ bool SPinVarPanel::IsSimpleStruct(const UScriptStruct* SS)
 }
 
 
-UClass* SPinVarPanel::ResolveGeneratedClassByShortName()
-{
-	const FString InName = ClassName.ToString();
-	const FString WantedGenName = InName.EndsWith(TEXT("_C")) ? InName : (InName + TEXT("_C"));
-
-	// Already loaded?
-	if (UClass* C = FindFirstObjectSafe<UClass>(*WantedGenName))
-	{
-		return C;
-	}
-
-	FAssetRegistryModule& ARM = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-
-	FARFilter Filter;
-	Filter.bRecursiveClasses = true;
-	Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
-
-	TArray<FAssetData> Assets;
-	ARM.Get().GetAssets(Filter, Assets);
-
-	for (const FAssetData& AD : Assets)
-	{
-		// UE5 tag: GeneratedClassPath (string form works across versions)
-		FString PathStr;
-		if (AD.GetTagValue(FBlueprintTags::GeneratedClassPath, PathStr) && !PathStr.IsEmpty())
-		{
-			if (FPackageName::ObjectPathToObjectName(PathStr) == WantedGenName)
-			{
-				UClass* C = FindObject<UClass>(nullptr, *PathStr);
-				if (!C) { C = LoadObject<UClass>(nullptr, *PathStr); }
-				if (C) { return C; }
-			}
-		}
-		// Fallback: load BP and use its GeneratedClass
-		if (UObject* Obj = AD.GetAsset())
-		{
-			if (UBlueprint* BP = Cast<UBlueprint>(Obj))
-			{
-				if (BP->GeneratedClass && BP->GeneratedClass->GetName() == WantedGenName)
-				{
-					return BP->GeneratedClass;
-				}
-			}
-		}
-	}
-
-	return nullptr;
-}
-
 bool SPinVarPanel::IsComplexStructContainer(const FProperty* P)
 {
 	if (!P) return false;
@@ -145,81 +106,105 @@ bool SPinVarPanel::IsContainerProperty(const FProperty* P)
 			|| P->IsA(FSetProperty::StaticClass()));
 }
 
-UObject* SPinVarPanel::FindComponentTemplate(UClass* Class, FName TemplateName)
+TSharedRef<SWidget> SPinVarPanel::MakeNestedMemberRow(UObject* Target, FName Path)
 {
-	if (!Class || TemplateName.IsNone()) return nullptr;
-
-	const FName Alt(*(TemplateName.ToString() + TEXT("_GEN_VARIABLE")));
-
-	// Walk this class and all supers
-	for (UClass* C = Class; C; C = C->GetSuperClass())
+	const TWeakObjectPtr<UObject> WeakTarget(Target);
+	// the text is polled every frame; keep the compiled path so polling skips the lookup,
+	// and only re-export when the subsystem reports a change to the root property
+	struct FCachedText
 	{
-		if (UObject* CDO = C->GetDefaultObject(true))
-		{
-			if (UObject* T = CDO->GetDefaultSubobjectByName(TemplateName)) return T;
-			if (UObject* T2 = CDO->GetDefaultSubobjectByName(Alt)) return T2;
-
-			TArray<UObject*> Subs;
-			GetObjectsWithOuter(CDO, Subs, true);
-			for (UObject* O : Subs)
+		uint32 Serial = MAX_uint32;
+		FText Text;
+	};
+	const TSharedRef<FCachedText> Cache = MakeShared<FCachedText>();
+	const FName RootName = FPinVarPropertyPath::GetRootName(Path);
+	const TSharedPtr<const FPinVarPropertyPath> Compiled =
+		UPinVarSubsystem::FindPropertyPath(Target ? Target->GetClass() : nullptr, Path);
+	const FProperty* Leaf = Compiled.IsValid() ? Compiled->GetLeafProperty() : nullptr;
+
+	return SNew(SHorizontalBox)
+		.ToolTipText(FText::FromString(Leaf ? Leaf->GetCPPType(nullptr) : TEXT("Unknown Type")))
+		+ SHorizontalBox::Slot().FillWidth(0.4f).VAlign(VAlign_Center).Padding(0, 0, 8, 0)
+		[
+			SNew(STextBlock).Text(FText::FromName(Path))
+		]
+		+ SHorizontalBox::Slot().FillWidth(0.6f)
+		[
+			SNew(SEditableTextBox)
+			.Text_Lambda([WeakTarget, Compiled, Cache, RootName]()
 			{
-				if (!O) continue;
-				const FName N = O->GetFName();
-				if (N == TemplateName || N == Alt)
-					return O;
-			}
-		}
-	}
-
-	// Last‑ditch global sweep (editor only): archetype components under any CDO in the chain
-	for (TObjectIterator<UActorComponent> It; It; ++It)
-	{
-		UActorComponent* Comp = *It;
-		if (!Comp || !Comp->HasAnyFlags(RF_ArchetypeObject)) continue;
-
-		// Check whether this component ultimately lives under one of our class CDOs
-		UObject* Outer = Comp->GetOuter();
-		while (Outer && !Outer->IsA<UClass>())
-		{
-			if (Outer->GetFName() == TemplateName || Outer->GetFName() == Alt) return Comp;
-			Outer = Outer->GetOuter();
-		}
-	}
-	return nullptr;
+				UObject* Obj = WeakTarget.Get();
+				UPinVarSubsystem* Subsystem = GEditor ? GEditor->GetEditorSubsystem<UPinVarSubsystem>() : nullptr;
+				const uint32 Serial = Subsystem && Obj ? Subsystem->GetValueSerial(Obj, RootName) : 0;
+				if (Serial == Cache->Serial) return Cache->Text;
+
+				FString Value;
+				if (Compiled.IsValid() && Obj) { Compiled->ExportValue(Obj, Value); }
+				Cache->Serial = Serial;
+				Cache->Text = FText::FromString(Value);
+				return Cache->Text;
+			})
+			.SelectAllTextWhenFocused(true)
+			.OnTextCommitted_Lambda([WeakTarget, Path](const FText& NewText, ETextCommit::Type CommitType)
+			{
+				if (CommitType == ETextCommit::OnCleared || !WeakTarget.IsValid() || !GEditor) return;
+				if (UPinVarSubsystem* Subsystem = GEditor->GetEditorSubsystem<UPinVarSubsystem>())
+				{
+					Subsystem->ApplyValueBatch({FPinVarValueWrite{WeakTarget, Path, NewText.ToString()}},
+					                           FText::FromString(TEXT("PinVar: Edit Value")));
+				}
+			})
+		];
 }
 
-void SPinVarPanel::BuildComponentOptions(UBlueprint* BP, UClass* Class, TArray<TSharedPtr<FCompOption>>& Out)
+void SPinVarPanel::BuildComponentOptions(UClass* Class, TArray<TSharedPtr<FCompOption>>& Out)
 {
 	Out.Reset();
 	if (!Class) return;
 
-	TSet<FName> Seen;
-	for (UClass* C = Class; C; C = C->GetSuperClass())
+	if (const TArray<TSharedPtr<FCompOption>>* Cached = ComponentOptionsCache.Find(Class))
 	{
-		if (UObject* CDO = C->GetDefaultObject(true))
+		// drop the cache entry if a template went away underneath us (GC, reinstancing)
+		const bool bStale = Cached->ContainsByPredicate([](const TSharedPtr<FCompOption>& Opt)
 		{
-			TArray<UObject*> Subs;
-			GetObjectsWithOuter(CDO, Subs, false);
-
-			for (UObject* O : Subs)
-			{
-				UActorComponent* Comp = Cast<UActorComponent>(O);
-				if (!Comp) continue;
+			return Opt->Template.IsStale();
+		});
+		if (!bStale)
+		{
+			Out = *Cached;
+			return;
+		}
+		ComponentOptionsCache.Remove(Class);
+	}
 
-				const FName TmplName = Comp->GetFName();
-				if (Seen.Contains(TmplName)) continue;
+	TRACE_CPUPROFILER_EVENT_SCOPE(PinVar_BuildComponentOptions);
 
-				Seen.Add(TmplName);
+	// template name -> option, so SCS nodes can patch existing entries without a linear search
+	TMap<FName, TSharedPtr<FCompOption>> ByTemplate;
 
-				TSharedRef<FCompOption> Opt = MakeShared<SPinVarPanel::FCompOption>();
-				Opt->Label = TmplName;
-				Opt->TemplateName = TmplName;
-				Opt->Template = Comp;
-				Out.Add(Opt);
-			}
-		}
+	// The most-derived CDO owns its own instance of every default subobject in the chain,
+	// so a single walk over its direct subobjects covers native components of all supers.
+	if (UObject* CDO = Class->GetDefaultObject(true))
+	{
+		ForEachObjectWithOuter(CDO, [&ByTemplate](UObject* O)
+		{
+			UActorComponent* Comp = Cast<UActorComponent>(O);
+			if (!Comp) return;
+
+			const FName TmplName = Comp->GetFName();
+			if (ByTemplate.Contains(TmplName)) return;
+
+			TSharedRef<FCompOption> Opt = MakeShared<FCompOption>();
+			Opt->Label = TmplName;
+			Opt->TemplateName = TmplName;
+			Opt->Template = Comp;
+			ByTemplate.Add(TmplName, Opt);
+		}, /*bIncludeNestedObjects*/ false);
 	}
 
+	// SCS nodes of every Blueprint in the hierarchy; templates are resolved against the
+	// most-derived class so inherited-component overrides are the ones we edit.
+	UBlueprintGeneratedClass* ActualBPGC = Cast<UBlueprintGeneratedClass>(Class);
 	for (UClass* C = Class; C; C = C->GetSuperClass())
 	{
 		UBlueprintGeneratedClass* BPGC = Cast<UBlueprintGeneratedClass>(C);
@@ -231,46 +216,41 @@ void SPinVarPanel::BuildComponentOptions(UBlueprint* BP, UClass* Class, TArray<T
 
 		for (USCS_Node* Node : SCS->GetAllNodes())
 		{
-			if (!Node || !C) return;
-			UActorComponent* ActualTemplate = BPGC ? Node->GetActualComponentTemplate(BPGC) : nullptr;
+			if (!Node) continue;
+
+			UActorComponent* ActualTemplate = Node->GetActualComponentTemplate(ActualBPGC ? ActualBPGC : BPGC);
 			if (!ActualTemplate)
 			{
 				ActualTemplate = Node->ComponentTemplate;
 			}
 
 			const FName Pretty = Node->GetVariableName();
-			FName TemplateKey = ActualTemplate
-				                    ? ActualTemplate->GetFName()
-				                    : FName(*(Pretty.ToString() + TEXT("_GEN_VARIABLE")));
+			const FName TemplateKey = ActualTemplate
+				                          ? ActualTemplate->GetFName()
+				                          : FName(*(Pretty.ToString() + TEXT("_GEN_VARIABLE")));
 
-			for (auto& Opt : Out)
+			if (TSharedPtr<FCompOption>* Existing = ByTemplate.Find(TemplateKey))
 			{
-				if (Opt->TemplateName == TemplateKey)
-				{
-					Opt->Label = Pretty;
-					if (ActualTemplate) { Opt->Template = ActualTemplate; }
-					return;
-				}
+				(*Existing)->Label = Pretty;
+				if (ActualTemplate) { (*Existing)->Template = ActualTemplate; }
+				continue;
 			}
 
-			// Otherwise add it now
-			if (!Seen.Contains(TemplateKey))
-			{
-				Seen.Add(TemplateKey);
-				TSharedRef<FCompOption> Opt = MakeShared<SPinVarPanel::FCompOption>();
-				Opt->Label = Pretty;
-				Opt->TemplateName = TemplateKey;
-				Opt->Template = ActualTemplate; // may be null (rare)
-				Out.Add(Opt);
-			}
+			TSharedRef<FCompOption> Opt = MakeShared<FCompOption>();
+			Opt->Label = Pretty;
+			Opt->TemplateName = TemplateKey;
+			Opt->Template = ActualTemplate; // may be null (rare)
+			ByTemplate.Add(TemplateKey, Opt);
 		}
 	}
 
-	Out.StableSort([](const TSharedPtr<SPinVarPanel::FCompOption>& A,
-	                  const TSharedPtr<SPinVarPanel::FCompOption>& B)
+	ByTemplate.GenerateValueArray(Out);
+	Out.StableSort([](const TSharedPtr<FCompOption>& A, const TSharedPtr<FCompOption>& B)
 	{
 		return A->Label.LexicalLess(B->Label);
 	});
+
+	ComponentOptionsCache.Add(Class, Out);
 }
 
 FString SPinVarPanel::PrettyBlueprintDisplayName(const UClass* Cls)
@@ -281,10 +261,59 @@ FString SPinVarPanel::PrettyBlueprintDisplayName(const UClass* Cls)
 	return N;
 }
 
+SPinVarPanel::~SPinVarPanel()
+{
+	FCoreUObjectDelegates::OnObjectsReplaced.Remove(ObjectsReplacedHandle);
+	if (GEditor && BlueprintCompiledHandle.IsValid())
+	{
+		GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+	}
+	if (GEditor && PinsValidatedHandle.IsValid())
+	{
+		if (UPinVarSubsystem* Subsystem = GEditor->GetEditorSubsystem<UPinVarSubsystem>())
+		{
+			Subsystem->OnPinsValidated.Remove(PinsValidatedHandle);
+			Subsystem->OnGroupsChanged.Remove(GroupsChangedHandle);
+			Subsystem->OnPinsChanged.Remove(PinsChangedHandle);
+		}
+	}
+
+	// closing the tab lets go of everything the panel loaded for display
+	for (TPair<int32, TSharedPtr<FStreamableHandle>>& Pair : GroupLoadHandles)
+	{
+		UPinVarSubsystem::ReleaseLoadHandle(Pair.Value);
+	}
+	for (TPair<FSoftObjectPath, TSharedPtr<FStreamableHandle>>& Pair : EditLoadHandles)
+	{
+		UPinVarSubsystem::ReleaseLoadHandle(Pair.Value);
+	}
+	for (TPair<int32, TSharedPtr<FStreamableHandle>>& Pair : PrefetchHandles)
+	{
+		UPinVarSubsystem::ReleaseLoadHandle(Pair.Value);
+	}
+}
+
 void SPinVarPanel::Construct(const FArguments& InArgs)
 {
 	OnRefreshRequested = InArgs._OnRefreshRequested;
 
+	if (GEditor)
+	{
+		// component layouts change on compile; cached options must be rebuilt
+		BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddSP(this, &SPinVarPanel::OnBlueprintCompiled);
+		ObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddSP(this, &SPinVarPanel::OnObjectsReplaced);
+
+		if (UPinVarSubsystem* Subsystem = GEditor->GetEditorSubsystem<UPinVarSubsystem>())
+		{
+			PinsValidatedHandle = Subsystem->OnPinsValidated.AddSP(this, &SPinVarPanel::OnPinsValidated);
+			GroupsChangedHandle = Subsystem->OnGroupsChanged.AddSP(this, &SPinVarPanel::OnGroupsChanged);
+			// undo / redo of pin edits patches only the classes involved
+			PinsChangedHandle = Subsystem->OnPinsChanged.AddSP(this, &SPinVarPanel::RefreshClasses);
+			// first consumer this session: resolve templates and start validation now
+			Subsystem->EnsureResolved();
+		}
+	}
+
 	ChildSlot
 	[
 		SNew(SVerticalBox)
@@ -305,7 +334,12 @@ void SPinVarPanel::Construct(const FArguments& InArgs)
 				.ToolTipText(FText::FromString(TEXT("Refresh pinned variables list")))
 				.OnClicked_Lambda([this]()
 				{
-					Refresh();
+					ReloadFromDisk();
+					// an explicit refresh also re-checks pins that were marked broken
+					if (UPinVarSubsystem* Subsystem = GEditor ? GEditor->GetEditorSubsystem<UPinVarSubsystem>() : nullptr)
+					{
+						Subsystem->RequestValidation();
+					}
 					return FReply::Handled();
 				})
 				[
@@ -325,29 +359,284 @@ void SPinVarPanel::Construct(const FArguments& InArgs)
 					SNew(STextBlock).Text(FText::FromString(TEXT("Add Variable")))
 				]
 			]
+
+			// CSV round-trip
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			[
+				SNew(SButton)
+				.ButtonStyle(FAppStyle::Get(), "FlatButton")
+				.ToolTipText(FText::FromString(TEXT("Write every pinned value to PinVar/Values.csv")))
+				.OnClicked(this, &SPinVarPanel::OnExportValuesCsv)
+				[
+					SNew(STextBlock).Text(FText::FromString(TEXT("Export CSV")))
+				]
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(6.f, 0.f)
+			[
+				SNew(SButton)
+				.ButtonStyle(FAppStyle::Get(), "FlatButton")
+				.ToolTipText(FText::FromString(TEXT("Preview and apply the values in PinVar/Values.csv")))
+				.OnClicked(this, &SPinVarPanel::OnImportValuesCsv)
+				[
+					SNew(STextBlock).Text(FText::FromString(TEXT("Import CSV")))
+				]
+			]
+
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.f)
+
+			// Group view <-> table view
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			[
+				SNew(SButton)
+				.ButtonStyle(FAppStyle::Get(), "FlatButton")
+				.ToolTipText(FText::FromString(TEXT("Compare pinned properties across targets in a table")))
+				.OnClicked_Lambda([this]()
+				{
+					SetTableMode(!bTableMode);
+					return FReply::Handled();
+				})
+				[
+					SNew(STextBlock)
+					.Text_Lambda([this]()
+					{
+						return FText::FromString(bTableMode ? TEXT("Group View") : TEXT("Table View"));
+					})
+				]
+			]
 		]
 
-		// Scrollable list
 		+ SVerticalBox::Slot()
 		.FillHeight(1.f)
 		[
-			SNew(SScrollBox)
-			+ SScrollBox::Slot()
+			SAssignNew(ViewSwitcher, SWidgetSwitcher)
+
+			// Scrollable list
+			+ SWidgetSwitcher::Slot()
+			[
+				SAssignNew(ListScrollBox, SScrollBox)
+				.OnUserScrolled_Lambda([this](float) { UpdateScrollPrefetch(); })
+				+ SScrollBox::Slot()
+				[
+					SAssignNew(RootBox, SVerticalBox)
+				]
+			]
+
+			// Table
+			+ SWidgetSwitcher::Slot()
 			[
-				SAssignNew(RootBox, SVerticalBox)
+				SAssignNew(Table, SPinVarTable)
 			]
 		]
 	];
 
+	// the subsystem already holds the pins; no disk access on construction
+	RebuildActiveView();
+}
+
+void SPinVarPanel::OnBlueprintCompiled()
+{
+	ComponentOptionsCache.Reset();
+
+	// a compile can add or remove the properties / components pins point at
+	if (UPinVarSubsystem* Subsystem = GEditor ? GEditor->GetEditorSubsystem<UPinVarSubsystem>() : nullptr)
+	{
+		Subsystem->RequestValidation();
+	}
+}
+
+void SPinVarPanel::OnObjectsReplaced(const TMap<UObject*, UObject*>& ReplacementMap)
+{
+	UPinVarSubsystem* Subsystem = GEditor ? GEditor->GetEditorSubsystem<UPinVarSubsystem>() : nullptr;
+	if (!Subsystem) return;
+
+	// a compile replaces the CDO and component templates; map those back to the pinned class keys
+	const int32 NumBefore = ReplacedClasses.Num();
+	for (const TPair<UObject*, UObject*>& Pair : ReplacementMap)
+	{
+		const UObject* New = Pair.Value;
+		if (!New) continue;
+
+		const UClass* Cls = nullptr;
+		if (New->HasAnyFlags(RF_ClassDefaultObject))
+		{
+			Cls = New->GetClass();
+		}
+		else if (New->HasAnyFlags(RF_ArchetypeObject | RF_DefaultSubObject))
+		{
+			Cls = New->GetTypedOuter<UClass>();
+			if (!Cls && New->GetOuter() && New->GetOuter()->HasAnyFlags(RF_ClassDefaultObject))
+			{
+				Cls = New->GetOuter()->GetClass();
+			}
+		}
+
+		if (Cls && !IsSkelOrReinst(Cls) && Subsystem->GetPinnedGroups().Contains(Cls->GetFName()))
+		{
+			ReplacedClasses.Add(Cls->GetFName());
+		}
+	}
+	if (ReplacedClasses.Num() == NumBefore || NumBefore > 0) return; // nothing new, or a refresh is already queued
+
+	// let the compile / reinstance finish before touching the new objects
+	RegisterActiveTimer(0.f, FWidgetActiveTimerDelegate::CreateLambda(
+		                    [WeakThis = TWeakPtr<SPinVarPanel>(SharedThis(this))](double, float)
+		                    {
+			                    if (TSharedPtr<SPinVarPanel> Panel = WeakThis.Pin())
+			                    {
+				                    const TSet<FName> Classes = MoveTemp(Panel->ReplacedClasses);
+				                    Panel->ReplacedClasses.Reset();
+				                    Panel->RefreshClasses(Classes);
+			                    }
+			                    return EActiveTimerReturnType::Stop;
+		                    }));
+}
+
+void SPinVarPanel::RefreshClasses(const TSet<FName>& Classes)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PinVar_RefreshClasses);
+
+	UPinVarSubsystem* Subsystem = GEditor ? GEditor->GetEditorSubsystem<UPinVarSubsystem>() : nullptr;
+	if (!Subsystem || Classes.Num() == 0) return;
+
+	// cached templates point at the pre-compile objects
+	for (const FName ClassName : Classes)
+	{
+		Subsystem->RepopulateSessionCache(ClassName);
+	}
+	ComponentOptionsCache.Reset();
+
+	if (bTableMode)
+	{
+		Table->Refresh();
+		return;
+	}
+	if (!GatherPinnedProperties(&Classes))
+	{
+		Rebuild();
+	}
+}
+
+void SPinVarPanel::OnPinsValidated()
+{
+	UPinVarSubsystem* Subsystem = GEditor ? GEditor->GetEditorSubsystem<UPinVarSubsystem>() : nullptr;
+	if (!Subsystem) return;
+
+	// only worth a rebuild when the validator disagrees with what is on screen
+	if (Subsystem->GetNumBrokenPins() != BrokenPins.Num())
+	{
+		RebuildActiveView();
+	}
+}
+
+FReply SPinVarPanel::OnRemoveAllBroken()
+{
+	UPinVarSubsystem* Subsystem = GEditor ? GEditor->GetEditorSubsystem<UPinVarSubsystem>() : nullptr;
+	if (!Subsystem || BrokenPins.Num() == 0) return FReply::Handled();
+
+	{
+		FPinVarPinTransaction Transaction(Subsystem, FText::FromString(TEXT("PinVar: Remove Broken Pins")));
+		for (const FBrokenPin& B : BrokenPins)
+		{
+			Subsystem->UnstagePinVariable(B.ClassName, B.Pin.VariableName, 0,
+			                              B.Pin.ComponentTemplateName, B.Pin.AssetPath);
+		}
+		Subsystem->MergeStagedIntoPinned();
+		Subsystem->SaveToDisk();
+	}
+	UE_LOG(LogTemp, Display, TEXT("PinVar: removed %d broken pins."), BrokenPins.Num());
+
 	Refresh();
+	return FReply::Handled();
 }
 
-void SPinVarPanel::Refresh()
+TSharedRef<SWidget> SPinVarPanel::MakeBrokenPinsSection()
+{
+	const UPinVarSubsystem* Subsystem = GEditor ? GEditor->GetEditorSubsystem<UPinVarSubsystem>() : nullptr;
+	TSharedRef<SVerticalBox> List = SNew(SVerticalBox);
+	for (const FBrokenPin& B : BrokenPins)
+	{
+		FString Where = B.ClassName.ToString();
+		if (!B.Pin.ComponentTemplateName.IsNone()) { Where += TEXT(" / ") + B.Pin.ComponentTemplateName.ToString(); }
+		if (!B.Pin.AssetPath.IsNull()) { Where += TEXT(" / ") + B.Pin.AssetPath.GetAssetName(); }
+
+		List->AddSlot().AutoHeight().Padding(6, 2)
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot().FillWidth(1.f).VAlign(VAlign_Center)
+			[
+				SNew(STextBlock)
+				.Text(FText::FromString(FString::Printf(TEXT("%s.%s  [%s]"), *Where, *B.Pin.VariableName.ToString(),
+				                                        Subsystem ? *Subsystem->GroupTable.GetPathList(B.Pin.GroupIds) : TEXT(""))))
+			]
+			+ SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Center).Padding(8, 0)
+			[
+				SNew(STextBlock)
+				.Text(FText::FromString(LexToString(B.Reason)))
+				.ColorAndOpacity(FLinearColor(0.9f, 0.5f, 0.2f))
+			]
+			+ SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Top)
+			[
+				SNew(SButton)
+				.ButtonStyle(FAppStyle::Get(), "FlatButton")
+				.ContentPadding(FMargin(4, 2))
+				.ToolTipText(FText::FromString(TEXT("Remove this pin from every group")))
+				.OnClicked(this, &SPinVarPanel::OnRemovePinned, B.ClassName, B.Pin.VariableName, 0,
+				           B.Pin.ComponentTemplateName, B.Pin.AssetPath)
+				[
+					SNew(STextBlock).Text(FText::FromString(TEXT("X"))).ColorAndOpacity(FLinearColor::Red)
+				]
+			]
+		];
+	}
+
+	return SNew(SExpandableArea)
+		.InitiallyCollapsed(true)
+		.HeaderContent()
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot().FillWidth(1.f).VAlign(VAlign_Center)
+			[
+				SNew(STextBlock)
+				.Text(FText::FromString(FString::Printf(TEXT("Broken pins (%d)"), BrokenPins.Num())))
+				.ColorAndOpacity(FLinearColor(0.9f, 0.5f, 0.2f))
+			]
+			+ SHorizontalBox::Slot().AutoWidth()
+			[
+				SNew(SButton)
+				.ButtonStyle(FAppStyle::Get(), "FlatButton")
+				.ToolTipText(FText::FromString(TEXT("Remove every pin that no longer resolves")))
+				.OnClicked(this, &SPinVarPanel::OnRemoveAllBroken)
+				[
+					SNew(STextBlock).Text(FText::FromString(TEXT("Remove all")))
+				]
+			]
+		]
+		.BodyContent()
+		[
+			List
+		];
+}
+
+void SPinVarPanel::ReloadFromDisk()
 {
+	// the owner re-reads Pinned.json into the subsystem (e.g. after a source control sync)
 	if (OnRefreshRequested.IsBound())
 	{
 		OnRefreshRequested.Execute();
 	}
+	Refresh();
+}
+
+void SPinVarPanel::Refresh()
+{
+	SCOPE_CYCLE_COUNTER(STAT_PinVar_Refresh);
+
+	ComponentOptionsCache.Reset();
 
 	if (GEditor)
 	{
@@ -358,17 +647,38 @@ void SPinVarPanel::Refresh()
 	}
 
 	Grouped.Reset();
-	Rebuild();
+	RebuildActiveView();
+}
+
+void SPinVarPanel::SetTableMode(bool bEnable)
+{
+	bTableMode = bEnable;
+	ViewSwitcher->SetActiveWidgetIndex(bTableMode ? 1 : 0);
+	RebuildActiveView();
+}
+
+void SPinVarPanel::RebuildActiveView()
+{
+	// only the visible view is kept up to date; switching rebuilds the other one
+	if (bTableMode)
+	{
+		Table->Refresh();
+	}
+	else
+	{
+		Rebuild();
+	}
 }
 
 void SPinVarPanel::Rebuild()
 {
+	SCOPE_CYCLE_COUNTER(STAT_PinVar_Rebuild);
+
 	for (auto& Pair : GroupAreaWidgets)
 	{
-		const FName GroupName = Pair.Key;
 		if (TSharedPtr<SExpandableArea> Area = Pair.Value.Pin())
 		{
-			GroupExpandedState.Add(GroupName, Area->IsExpanded());
+			GroupExpandedState.Add(Pair.Key, Area->IsExpanded());
 		}
 	}
 	GroupAreaWidgets.Empty();
@@ -376,7 +686,24 @@ void SPinVarPanel::Rebuild()
 	RootBox->ClearChildren();
 	GatherPinnedProperties();
 
-	if (Grouped.Num() == 0)
+	if (NumPinsAwaitingDiscovery > 0)
+	{
+		RootBox->AddSlot().AutoHeight().Padding(4.f)
+		[
+			SNew(STextBlock)
+			.ColorAndOpacity(FLinearColor(0.7f, 0.7f, 0.7f))
+			.Text(FText::FromString(FString::Printf(
+				TEXT("Discovering assets… %d pins will appear when their Blueprints are found."),
+				NumPinsAwaitingDiscovery)))
+		];
+	}
+
+	if (BrokenPins.Num() > 0)
+	{
+		RootBox->AddSlot().AutoHeight().Padding(0.f, 4.f)[MakeBrokenPinsSection()];
+	}
+
+	if (Grouped.Num() == 0 && NumPinsAwaitingDiscovery == 0)
 	{
 		RootBox->AddSlot()
 		       .AutoHeight()
@@ -391,8 +718,8 @@ void SPinVarPanel::Rebuild()
 
 	for (auto& KV : Grouped)
 	{
-		const FName Group = KV.Key;
 		TArray<FEntry>& Entries = KV.Value;
+		const int32 GroupId = Entries.Num() > 0 ? Entries[0].GroupId : 0;
 
 		TSharedRef<SVerticalBox> ListVB = SNew(SVerticalBox);
 
@@ -400,9 +727,10 @@ void SPinVarPanel::Rebuild()
 		TSharedRef<SExpandableArea> Area =
 			SNew(SExpandableArea)
 			.InitiallyCollapsed(true)
+			.OnAreaExpansionChanged(this, &SPinVarPanel::OnGroupExpansionChanged, GroupId)
 			.HeaderContent()
 			[
-				SNew(STextBlock).Text(FText::FromName(Group))
+				MakeGroupHeader(GroupId)
 			]
 			.BodyContent()
 			[
@@ -418,14 +746,16 @@ void SPinVarPanel::Rebuild()
 			];
 
 		// Restore expansion if we remembered it
-		const bool* Remembered = GroupExpandedState.Find(Group);
+		const bool* Remembered = GroupExpandedState.Find(GroupId);
 		if (Remembered && *Remembered)
 		{
 			Area->SetExpanded(true);
+			RequestGroupAssets(GroupId);
 		}
 
 		// Track this area so we can snapshot its state next rebuild
-		GroupAreaWidgets.Add(Group, Area);
+		GroupAreaWidgets.Add(GroupId, Area);
+		WatchGroupHover(GroupId, Area);
 
 		RootBox->AddSlot()
 		       .AutoHeight()
@@ -486,29 +816,10 @@ void SPinVarPanel::GetAllGroups(TSharedRef<FState> S)
 	{
 		if (UPinVarSubsystem* Subsystem = GEditor->GetEditorSubsystem<UPinVarSubsystem>())
 		{
-			// Pull from pinned mirror
-			for (const auto& Pair : Subsystem->PinnedGroups) // Map<FName ClassName, TArray<FPinnedVariable>>
-			{
-				for (const FPinnedVariable& E : Pair.Value)
-				{
-					if (!E.GroupName.IsNone())
-					{
-						Unique.Add(E.GroupName.ToString());
-					}
-				}
-			}
-
-			// (Optional) also include staged-only entries, if any
-			for (const auto& Pair : Subsystem->StagedPinnedGroups)
-			{
-				for (const FPinnedVariable& E : Pair.Value)
-				{
-					if (!E.GroupName.IsNone())
-					{
-						Unique.Add(E.GroupName.ToString());
-					}
-				}
-			}
+			// every live group record (empty groups are pruned on merge)
+			TArray<FString> Paths;
+			Subsystem->GroupTable.GetAllPaths(Paths);
+			Unique.Append(Paths);
 		}
 	}
 
@@ -533,11 +844,13 @@ bool SPinVarPanel::IsNativeDeclared(const FProperty* P)
 	return (OwnerClass && OwnerClass->ClassGeneratedBy == nullptr);
 }
 
-void SPinVarPanel::GatherPinnedProperties()
+bool SPinVarPanel::GatherPinnedProperties(const TSet<FName>* OnlyClasses)
 {
-	if (!GEditor) return;
+	SCOPE_CYCLE_COUNTER(STAT_PinVar_Gather);
+
+	if (!GEditor) return false;
 	UPinVarSubsystem* Subsystem = GEditor->GetEditorSubsystem<UPinVarSubsystem>();
-	if (!Subsystem) return;
+	if (!Subsystem) return false;
 
 	FPropertyEditorModule& PropEd = FModuleManager::LoadModuleChecked<FPropertyEditorModule>("PropertyEditor");
 
@@ -554,86 +867,167 @@ void SPinVarPanel::GatherPinnedProperties()
 		TMap<FName, TWeakObjectPtr<UObject>> ComponentTemplates; // PrettyLabel -> Template
 
 		TMap<FName, TArray<FName>> AssetVarsByName; // AssetName -> [Var]
-		TMap<FName, TWeakObjectPtr<UObject>> AssetsByName; // AssetName -> UObject
+		TMap<FName, TWeakObjectPtr<UObject>> AssetsByName; // AssetName -> UObject (loaded only)
+		TMap<FName, FSoftObjectPath> AssetPathsByName; // AssetName -> path
+		TMap<FName, TMap<FName, FString>> AssetPreviewsByName; // AssetName -> (Var -> registry tag value), unloaded only
+
+		// (target, var) -> path resolved during collect, so emitting a row does no field lookup
+		TMap<TPair<const UObject*, FName>, TSharedPtr<const FPinVarPropertyPath>> Paths;
 	};
 
 	// ---------- tree for subcategories ----------
 	struct FGroupNode
 	{
 		FName Segment; // e.g. "Combat"
+		int32 GroupId = 0;
 		TMap<FName, TSharedPtr<FGroupNode>> Children;
 	};
 
-	// leaf full path -> (class -> buckets)
-	TMap<FString, TMap<FName, FClassBuckets>> BuildByPath;
+	// group id -> (class -> buckets)
+	TMap<int32, TMap<FName, FClassBuckets>> BuildByGroup;
+	const FPinVarGroupTable& GroupTable = Subsystem->GroupTable;
+	TSet<int32> ResolvedGroups;
+	TArray<int32> Chain;
 	// top-level segment -> node
 	TMap<FName, TSharedPtr<FGroupNode>> Roots;
 
+	const int32 NumBrokenBefore = BrokenPins.Num();
+	if (OnlyClasses)
+	{
+		BrokenPins.RemoveAll([OnlyClasses](const FBrokenPin& B) { return OnlyClasses->Contains(B.ClassName); });
+	}
+	else
+	{
+		AssetsByGroup.Reset();
+		AssetClassesByGroup.Reset();
+		BrokenPins.Reset();
+		NumPinsAwaitingDiscovery = 0;
+		ClassSectionHolders.Reset();
+	}
+
+	// while the registry is still scanning, an unknown class is not evidence of a broken pin
+	const bool bDiscoveryInProgress =
+		FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get().IsLoadingAssets();
+
+	auto AddBroken = [this](FName Class, const FPinnedVariable& Pin, EPinVarResolveResult Reason)
+	{
+		BrokenPins.Add({Class, Pin, Reason});
+	};
+
 	// ---------- collect ----------
-	for (const TPair<FName, TArray<FPinnedVariable>>& Pair : Subsystem->PinnedGroups)
+	for (const TPair<FName, TArray<FPinnedVariable>>& Pair : Subsystem->GetPinnedGroups())
 	{
-		ClassName = Pair.Key;
-		UClass* Cls = FindFirstObjectSafe<UClass>(*ClassName.ToString());
-		if (!Cls) Cls = ResolveGeneratedClassByShortName();
-		if (!Cls || IsSkelOrReinst(Cls)) continue;
+		if (OnlyClasses && !OnlyClasses->Contains(Pair.Key)) continue;
 
-		UObject* CDO = Cls->GetDefaultObject(true);
-		if (!CDO) continue;
+		// the validator already found this class missing; skip the registry lookup entirely
+		const bool bClassKnownMissing = Pair.Value.Num() > 0 && !Pair.Value.ContainsByPredicate(
+			[Subsystem, &Pair](const FPinnedVariable& E)
+			{
+				return Subsystem->GetResolveState(Pair.Key, E) != EPinVarResolveResult::MissingClass;
+			});
+
+		UClass* Cls = bClassKnownMissing ? nullptr : UPinVarSubsystem::ResolveClassByName(Pair.Key);
+		UObject* CDO = Cls ? Cls->GetDefaultObject(true) : nullptr;
+		if (!CDO && bDiscoveryInProgress)
+		{
+			if (OnlyClasses) return false; // the discovery line is not per class
+			NumPinsAwaitingDiscovery += Pair.Value.Num();
+			continue;
+		}
+		if (!CDO)
+		{
+			for (const FPinnedVariable& E : Pair.Value) { AddBroken(Pair.Key, E, EPinVarResolveResult::MissingClass); }
+			continue;
+		}
+		if (IsSkelOrReinst(Cls)) continue;
 
 		const FName ClassFName = Cls->GetFName();
 		const FText ClassLabel = FText::FromString(PrettyBlueprintDisplayName(Cls));
 
 		for (const FPinnedVariable& Pinned : Pair.Value)
 		{
+			const EPinVarResolveResult ResolveState = Subsystem->GetResolveState(Pair.Key, Pinned);
+			if (IsBrokenPin(ResolveState))
+			{
+				AddBroken(Pair.Key, Pinned, ResolveState);
+				continue;
+			}
+
 			UObject* Target = CDO;
 
-			// asset target
+			// asset target; unloaded assets show registry-tag previews or a placeholder that loads on expand
 			if (!Pinned.AssetPath.IsNull())
 			{
 				Target = Pinned.AssetPath.ResolveObject();
-				if (!Target) Target = Pinned.AssetPath.TryLoad();
-				if (!Target) continue;
 			}
 
 			// component target
 			if (!Pinned.ComponentTemplateName.IsNone())
 			{
-				Target = Pinned.ResolvedTemplate.IsValid()
-					         ? Pinned.ResolvedTemplate.Get()
-					         : FindComponentTemplate(Cls, Pinned.ComponentTemplateName);
-				if (!Target) continue;
+				Target = Subsystem->GetResolvedTemplate(Pair.Key, Pinned);
+				if (!Target) Target = UPinVarSubsystem::FindComponentTemplate(Cls, Pinned.ComponentTemplateName);
+				if (!Target)
+				{
+					AddBroken(Pair.Key, Pinned, EPinVarResolveResult::MissingComponent);
+					continue;
+				}
 			}
 
-			FProperty* Found = FindFProperty<FProperty>(Target->GetClass(), Pinned.VariableName);
-			if (!Found || !IsEditableProperty(Found)) continue;
+			// editability and BP/native placement are decided by the top-level property of a nested path
+			FProperty* Found = nullptr;
+			TSharedPtr<const FPinVarPropertyPath> Path;
+			if (Target)
+			{
+				Path = UPinVarSubsystem::GetPinPropertyPath(Pinned, Target->GetClass());
+				if (!Path.IsValid())
+				{
+					AddBroken(Pair.Key, Pinned, EPinVarResolveResult::MissingProperty);
+					continue;
+				}
+				Found = Path->GetRootProperty();
+				if (!IsEditableProperty(Found)) continue;
+				INC_DWORD_STAT(STAT_PinVar_PinsResolved);
+			}
 
-			TArray<FString> Tokens;
-			const FString GroupCsv = Pinned.GroupName.ToString();
-			GroupCsv.ParseIntoArray(Tokens, TEXT(","), /*CullEmpty*/ true);
-			if (Tokens.Num() == 0) Tokens.Add(GroupCsv);
+			// searchable properties of an unloaded asset are read from its registry tags; no load needed to show them
+			FString Preview;
+			const bool bPreview = !Target && !Pinned.AssetPath.IsNull() &&
+				UPinVarSubsystem::GetUnloadedValuePreview(Pinned.AssetPath, Pinned.VariableName, Preview);
 
-			for (FString Tok : Tokens)
+			// the pin was resolved once above; every group it belongs to reuses Target and Path
+			ResolvedGroups.Reset();
+			for (const int32 PinGroupId : Pinned.GroupIds)
 			{
-				Tok = Tok.TrimStartAndEnd();
-				if (Tok.IsEmpty()) continue;
+				const int32 GroupId = GroupTable.Resolve(PinGroupId);
+				bool bListed = false;
+				ResolvedGroups.Add(GroupId, &bListed);
+				if (GroupId == 0 || bListed) continue; // a merge can leave a pin listed twice in one group
 
-				// split by '|' for subcategories
-				TArray<FString> Segs;
-				Tok.ParseIntoArray(Segs, TEXT("|"), true);
-				for (FString& S : Segs) S = S.TrimStartAndEnd();
-				if (Segs.Num() == 0) continue;
-
-				const FString FullPath = FString::Join(Segs, TEXT("|"));
-				TMap<FName, FClassBuckets>& ClassMap = BuildByPath.FindOrAdd(FullPath);
+				TMap<FName, FClassBuckets>& ClassMap = BuildByGroup.FindOrAdd(GroupId);
 				FClassBuckets& B = ClassMap.FindOrAdd(ClassFName);
 				B.ClassName = ClassFName;
 				B.ClassLabel = ClassLabel;
+				if (Path.IsValid())
+				{
+					B.Paths.Add(TPair<const UObject*, FName>(Target, Pinned.VariableName), Path);
+				}
 
 				if (!Pinned.AssetPath.IsNull())
 				{
-					const FName AssetLabel(*Target->GetName());
+					const FName AssetLabel(*Pinned.AssetPath.GetAssetName());
 					B.AssetVarsByName.FindOrAdd(AssetLabel).Add(Pinned.VariableName);
-					B.AssetsByName.FindOrAdd(AssetLabel) = Target;
+					B.AssetPathsByName.FindOrAdd(AssetLabel) = Pinned.AssetPath;
+					if (bPreview)
+					{
+						B.AssetPreviewsByName.FindOrAdd(AssetLabel).Add(Pinned.VariableName, Preview);
+					}
+					else
+					{
+						// held by the group while it is expanded, whether or not it is resident right now
+						AssetsByGroup.FindOrAdd(GroupId).Add(Pinned.AssetPath);
+						AssetClassesByGroup.FindOrAdd(GroupId).Add(Pair.Key);
+						if (Target) B.AssetsByName.FindOrAdd(AssetLabel) = Target;
+					}
 				}
 				else if (Pinned.ComponentTemplateName.IsNone())
 				{
@@ -651,307 +1045,396 @@ void SPinVarPanel::GatherPinnedProperties()
 					B.ComponentTemplates.FindOrAdd(CompLabel) = Target;
 				}
 
-				// build tree path
-				const FName RootSeg(*Segs[0]);
-				TSharedPtr<FGroupNode>& Root = Roots.FindOrAdd(RootSeg);
-				if (!Root)
+				// build tree path from the group's ancestors
+				GroupTable.GetAncestry(GroupId, Chain);
+				TMap<FName, TSharedPtr<FGroupNode>>* Level = &Roots;
+				for (const int32 NodeId : Chain)
 				{
-					Root = MakeShared<FGroupNode>();
-					Root->Segment = RootSeg;
-				}
-
-				TSharedPtr<FGroupNode> Cursor = Root;
-				for (int32 i = 1; i < Segs.Num(); ++i)
-				{
-					const FName Seg(*Segs[i]);
-					TSharedPtr<FGroupNode>& Child = Cursor->Children.FindOrAdd(Seg);
-					if (!Child)
+					const FName Seg = GroupTable.GetName(NodeId);
+					TSharedPtr<FGroupNode>& Node = Level->FindOrAdd(Seg);
+					if (!Node)
 					{
-						Child = MakeShared<FGroupNode>();
-						Child->Segment = Seg;
+						Node = MakeShared<FGroupNode>();
+						Node->Segment = Seg;
+						Node->GroupId = NodeId;
 					}
-					Cursor = Child;
+					Level = &Node->Children;
 				}
 			}
 		}
 	}
 
-	// helper: make class sections for a leaf path
-	auto MakeClassSectionsForPath = [&](const FString& FullPath) -> TSharedRef<SVerticalBox>
+	// one class inside one group; each sits in its own holder so a recompile can swap just that section
+	auto MakeClassSection = [&](const int32 GroupId, FClassBuckets& B) -> TSharedRef<SVerticalBox>
 	{
 		TSharedRef<SVerticalBox> VB = SNew(SVerticalBox);
-		TMap<FName, FClassBuckets>* ClassesPtr = BuildByPath.Find(FullPath);
-		if (!ClassesPtr) return VB;
-
-		TArray<FName> ClassOrder;
-		ClassesPtr->GenerateKeyArray(ClassOrder);
-		ClassOrder.Sort([&](const FName& A, const FName& B)
-		{
-			return (*ClassesPtr)[A].ClassLabel.ToString().Compare((*ClassesPtr)[B].ClassLabel.ToString(),
-			                                                      ESearchCase::IgnoreCase) < 0;
-		});
+		B.BPVars.Sort(FNameLexicalLess());
+		B.NativeVars.Sort(FNameLexicalLess());
+		for (auto& It : B.ComponentVarsByName) { It.Value.Sort(FNameLexicalLess()); }
+
+		TArray<FName> CompNames;
+		B.ComponentVarsByName.GenerateKeyArray(CompNames);
+		CompNames.Sort(FNameLexicalLess());
+		TArray<FName> AssetNames;
+		B.AssetVarsByName.GenerateKeyArray(AssetNames);
+		AssetNames.Sort(FNameLexicalLess());
+
+		VB->AddSlot().AutoHeight().Padding(6, 8, 6, 4)
+		[
+			SNew(STextBlock).Text(B.ClassLabel).Font(FCoreStyle::GetDefaultFontStyle("Bold", 14))
+		];
 
-		for (const FName& CN : ClassOrder)
+		// emitters
+		auto EmitPropOnly = [&](UObject* Target, const FName Var)-> TSharedRef<SWidget>
 		{
-			FClassBuckets& B = (*ClassesPtr)[CN];
-			B.BPVars.Sort(FNameLexicalLess());
-			B.NativeVars.Sort(FNameLexicalLess());
-			for (auto& It : B.ComponentVarsByName) { It.Value.Sort(FNameLexicalLess()); }
-
-			TArray<FName> CompNames;
-			B.ComponentVarsByName.GenerateKeyArray(CompNames);
-			CompNames.Sort(FNameLexicalLess());
-			TArray<FName> AssetNames;
-			B.AssetVarsByName.GenerateKeyArray(AssetNames);
-			AssetNames.Sort(FNameLexicalLess());
-
-			VB->AddSlot().AutoHeight().Padding(6, 8, 6, 4)
-			[
-				SNew(STextBlock).Text(B.ClassLabel).Font(FCoreStyle::GetDefaultFontStyle("Bold", 14))
-			];
+			TRACE_CPUPROFILER_EVENT_SCOPE(PinVar_CreatePropertyWidget);
+			INC_DWORD_STAT(STAT_PinVar_WidgetsCreated);
 
-			// emitters
-			auto EmitPropOnly = [&](UObject* Target, const FName Var)-> TSharedRef<SWidget>
+			// nested member ("Movement.MaxSpeed"): the property editor only builds top-level rows, so edit as text
+			if (FPinVarPropertyPath::IsNested(Var))
 			{
-				FProperty* P = FindFProperty<FProperty>(Target->GetClass(), Var);
+				return MakeNestedMemberRow(Target, Var);
+			}
 
-				// struct handling
-				if (FStructProperty* SP = CastField<FStructProperty>(P))
+			const TSharedPtr<const FPinVarPropertyPath>* Cached =
+				B.Paths.Find(TPair<const UObject*, FName>(Target, Var));
+			const TSharedPtr<const FPinVarPropertyPath> Path = Cached
+				                                                  ? *Cached
+				                                                  : UPinVarSubsystem::FindPropertyPath(
+					                                                  Target->GetClass(), Var);
+			FProperty* P = Path.IsValid() ? Path->GetRootProperty() : nullptr;
+
+			// struct handling
+			if (FStructProperty* SP = CastField<FStructProperty>(P))
+			{
+				UScriptStruct* SS = SP->Struct;
+				if (SS && IsSimpleStruct(SS))
+				{
+					FSinglePropertyParams Params;
+					TSharedPtr<ISinglePropertyView> View = PropEd.CreateSingleProperty(Target, Var, Params);
+					TSharedRef<SWidget> Inner = View.IsValid()
+						                            ? StaticCastSharedRef<SWidget>(View.ToSharedRef())
+						                            : StaticCastSharedRef<SWidget>(
+							                            SNew(STextBlock).Text(FText::FromName(Var)));
+					return SNew(SBox).ToolTipText(
+							FText::FromString(P ? P->GetCPPType(nullptr) : TEXT("Unknown Type")))
+						[
+							Inner
+						];
+				}
+				if (SS)
 				{
-					UScriptStruct* SS = SP->Struct;
-					if (SS && IsSimpleStruct(SS))
+					void* ValuePtr = SP->ContainerPtrToValuePtr<void>(Target);
+					if (ValuePtr)
 					{
-						FSinglePropertyParams Params;
-						TSharedPtr<ISinglePropertyView> View = PropEd.CreateSingleProperty(Target, Var, Params);
-						TSharedRef<SWidget> Inner = View.IsValid()
-							                            ? StaticCastSharedRef<SWidget>(View.ToSharedRef())
-							                            : StaticCastSharedRef<SWidget>(
-								                            SNew(STextBlock).Text(FText::FromName(Var)));
-						return SNew(SBox).ToolTipText(
-								FText::FromString(P ? P->GetCPPType(nullptr) : TEXT("Unknown Type")))
+						TSharedRef<FStructOnScope> Scope = MakeShared<FStructOnScope>(
+							SS, reinterpret_cast<uint8*>(ValuePtr));
+						FDetailsViewArgs DArgs;
+						DArgs.bAllowSearch = false;
+						DArgs.bShowOptions = false;
+						DArgs.bShowScrollBar = false;
+						DArgs.bHideSelectionTip = true;
+						DArgs.bShowObjectLabel = false;
+						FStructureDetailsViewArgs SArgs;
+						SArgs.bShowObjects = false;
+						SArgs.bShowAssets = false;
+						TSharedRef<IStructureDetailsView> SDV = PropEd.CreateStructureDetailView(
+							DArgs, SArgs, nullptr);
+						SDV->SetStructureData(Scope);
+						return SNew(SVerticalBox)
+							+ SVerticalBox::Slot().AutoHeight()
 							[
-								Inner
+								SNew(STextBlock).Text(FText::FromName(Var))
+							]
+							+ SVerticalBox::Slot().AutoHeight()
+							[
+								SDV->GetWidget().ToSharedRef()
 							];
 					}
-					if (SS)
+				}
+			}
+
+			// containers
+			if (IsContainerProperty(P))
+			{
+				FDetailsViewArgs DArgs;
+				DArgs.bAllowSearch = false;
+				DArgs.bShowOptions = false;
+				DArgs.bShowScrollBar = false;
+				DArgs.bHideSelectionTip = true;
+				DArgs.bShowObjectLabel = false;
+				DArgs.NameAreaSettings = FDetailsViewArgs::HideNameArea;
+				TSharedRef<IDetailsView> DV = PropEd.CreateDetailView(DArgs);
+				DV->SetIsPropertyVisibleDelegate(FIsPropertyVisible::CreateLambda(
+					[Var](const FPropertyAndParent& In)
 					{
-						void* ValuePtr = SP->ContainerPtrToValuePtr<void>(Target);
-						if (ValuePtr)
+						if (In.Property.GetFName() == Var) return true;
+						for (const FProperty* Parent : In.ParentProperties)
 						{
-							TSharedRef<FStructOnScope> Scope = MakeShared<FStructOnScope>(
-								SS, reinterpret_cast<uint8*>(ValuePtr));
-							FDetailsViewArgs DArgs;
-							DArgs.bAllowSearch = false;
-							DArgs.bShowOptions = false;
-							DArgs.bShowScrollBar = false;
-							DArgs.bHideSelectionTip = true;
-							DArgs.bShowObjectLabel = false;
-							FStructureDetailsViewArgs SArgs;
-							SArgs.bShowObjects = false;
-							SArgs.bShowAssets = false;
-							TSharedRef<IStructureDetailsView> SDV = PropEd.CreateStructureDetailView(
-								DArgs, SArgs, nullptr);
-							SDV->SetStructureData(Scope);
-							return SNew(SVerticalBox)
-								+ SVerticalBox::Slot().AutoHeight()
-								[
-									SNew(STextBlock).Text(FText::FromName(Var))
-								]
-								+ SVerticalBox::Slot().AutoHeight()
-								[
-									SDV->GetWidget().ToSharedRef()
-								];
+							if (Parent && Parent->GetFName() == Var) return true;
 						}
-					}
-				}
-
-				// containers
-				if (IsContainerProperty(P))
+						return false;
+					}));
+				if (!IsComplexStructContainer(P))
 				{
-					FDetailsViewArgs DArgs;
-					DArgs.bAllowSearch = false;
-					DArgs.bShowOptions = false;
-					DArgs.bShowScrollBar = false;
-					DArgs.bHideSelectionTip = true;
-					DArgs.bShowObjectLabel = false;
-					DArgs.NameAreaSettings = FDetailsViewArgs::HideNameArea;
-					TSharedRef<IDetailsView> DV = PropEd.CreateDetailView(DArgs);
-					DV->SetIsPropertyVisibleDelegate(FIsPropertyVisible::CreateLambda(
-						[Var](const FPropertyAndParent& In)
+					const FString VarStr = Var.ToString();
+					DV->SetIsCustomRowVisibleDelegate(FIsCustomRowVisible::CreateLambda(
+						[VarStr](FName, FName PropName)
 						{
-							if (In.Property.GetFName() == Var) return true;
-							for (const FProperty* Parent : In.ParentProperties)
-							{
-								if (Parent && Parent->GetFName() == Var) return true;
-							}
-							return false;
+							if (PropName.IsNone()) return true;
+							const FString N = PropName.ToString();
+							return N == VarStr || N.StartsWith(VarStr + TEXT(".")) || N.StartsWith(
+								VarStr + TEXT("_"));
 						}));
-					if (!IsComplexStructContainer(P))
-					{
-						const FString VarStr = Var.ToString();
-						DV->SetIsCustomRowVisibleDelegate(FIsCustomRowVisible::CreateLambda(
-							[VarStr](FName, FName PropName)
-							{
-								if (PropName.IsNone()) return true;
-								const FString N = PropName.ToString();
-								return N == VarStr || N.StartsWith(VarStr + TEXT(".")) || N.StartsWith(
-									VarStr + TEXT("_"));
-							}));
-					}
-					DV->SetObject(Target);
-					return SNew(SVerticalBox)
-						+ SVerticalBox::Slot().AutoHeight()
-						[
-							SNew(STextBlock).Text(FText::FromName(Var))
-						]
-						+ SVerticalBox::Slot().AutoHeight()
-						[
-							DV
-						];
 				}
-
-				// simple single row
-				FSinglePropertyParams Params;
-				TSharedPtr<ISinglePropertyView> View = PropEd.CreateSingleProperty(Target, Var, Params);
-				TSharedRef<SWidget> Inner = View.IsValid()
-					                            ? StaticCastSharedRef<SWidget>(View.ToSharedRef())
-					                            : StaticCastSharedRef<SWidget>(
-						                            SNew(STextBlock).Text(FText::FromName(Var)));
-				return SNew(SBox).ToolTipText(FText::FromString(P ? P->GetCPPType(nullptr) : TEXT("Unknown Type")))
+				DV->SetObject(Target);
+				return SNew(SVerticalBox)
+					+ SVerticalBox::Slot().AutoHeight()
+					[
+						SNew(STextBlock).Text(FText::FromName(Var))
+					]
+					+ SVerticalBox::Slot().AutoHeight()
 					[
-						Inner
+						DV
 					];
-			};
+			}
 
-			auto EmitPropWithDelete = [&](UObject* Target, const FName Var, const FName ClassName,
-			                              const FName CompNameForRemoval)-> TSharedRef<SWidget>
-			{
-				return SNew(SHorizontalBox)
-					+ SHorizontalBox::Slot().FillWidth(1.f)
+			// simple single row
+			FSinglePropertyParams Params;
+			TSharedPtr<ISinglePropertyView> View = PropEd.CreateSingleProperty(Target, Var, Params);
+			TSharedRef<SWidget> Inner = View.IsValid()
+				                            ? StaticCastSharedRef<SWidget>(View.ToSharedRef())
+				                            : StaticCastSharedRef<SWidget>(
+					                            SNew(STextBlock).Text(FText::FromName(Var)));
+			return SNew(SBox).ToolTipText(FText::FromString(P ? P->GetCPPType(nullptr) : TEXT("Unknown Type")))
+				[
+					Inner
+				];
+		};
+
+		auto EmitPropWithDelete = [&](UObject* Target, const FName Var, const FName ClassName,
+		                              const FName CompNameForRemoval,
+		                              const FSoftObjectPath& AssetForRemoval = FSoftObjectPath())-> TSharedRef<SWidget>
+		{
+			return SNew(SHorizontalBox)
+				+ SHorizontalBox::Slot().FillWidth(1.f)
+				[
+					EmitPropOnly(Target, Var)
+				]
+				+ SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Top).Padding(6, 2, 0, 0)
+				[
+					SNew(SButton)
+					.ButtonStyle(FAppStyle::Get(), "FlatButton")
+					.ContentPadding(FMargin(4, 2))
+					.ToolTipText(FText::FromString(TEXT("Remove this variable from the list")))
+					.OnClicked(this, &SPinVarPanel::OnRemovePinned, ClassName, Var, GroupId,
+					           CompNameForRemoval, AssetForRemoval)
 					[
-						EmitPropOnly(Target, Var)
+						SNew(STextBlock).Text(FText::FromString(TEXT("X"))).ColorAndOpacity(FLinearColor::Red)
 					]
-					+ SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Top).Padding(6, 2, 0, 0)
-					[
-						SNew(SButton)
-						.ButtonStyle(FAppStyle::Get(), "FlatButton")
-						.ContentPadding(FMargin(4, 2))
-						.ToolTipText(FText::FromString(TEXT("Remove this variable from the list")))
-						.OnClicked(this, &SPinVarPanel::OnRemovePinned, ClassName, Var, FName(*FullPath),
-						           CompNameForRemoval)
-						[
-							SNew(STextBlock).Text(FText::FromString(TEXT("X"))).ColorAndOpacity(FLinearColor::Red)
-						]
-					];
-			};
+				];
+		};
 
-			// class defaults
-			if (UClass* C = FindFirstObjectSafe<UClass>(*B.ClassName.ToString()))
+		// class defaults
+		if (UClass* C = FindFirstObjectSafe<UClass>(*B.ClassName.ToString()))
+		{
+			if (UObject* CDO = C->GetDefaultObject(true))
 			{
-				if (UObject* CDO = C->GetDefaultObject(true))
-				{
-					for (const FName& V : B.BPVars)
-						VB->AddSlot().AutoHeight().Padding(16, 2)[EmitPropWithDelete(
-							CDO, V, B.ClassName, NAME_None)];
-					for (const FName& V : B.NativeVars)
-						VB->AddSlot().AutoHeight().Padding(16, 2)[EmitPropWithDelete(
-							CDO, V, B.ClassName, NAME_None)];
-				}
+				for (const FName& V : B.BPVars)
+					VB->AddSlot().AutoHeight().Padding(16, 2)[EmitPropWithDelete(
+						CDO, V, B.ClassName, NAME_None)];
+				for (const FName& V : B.NativeVars)
+					VB->AddSlot().AutoHeight().Padding(16, 2)[EmitPropWithDelete(
+						CDO, V, B.ClassName, NAME_None)];
 			}
+		}
 
-			// components
+		// components
+		{
+			TArray<FName> CompLabels;
+			B.ComponentVarsByName.GenerateKeyArray(CompLabels);
+			CompLabels.Sort(FNameLexicalLess());
+			for (const FName& CompLabel : CompLabels)
 			{
-				TArray<FName> CompLabels;
-				B.ComponentVarsByName.GenerateKeyArray(CompLabels);
-				CompLabels.Sort(FNameLexicalLess());
-				for (const FName& CompLabel : CompLabels)
+				VB->AddSlot().AutoHeight().Padding(10, 8, 6, 2)
+				[
+					SNew(STextBlock)
+					.Text(FText::FromString(FString::Printf(TEXT("Component: %s"), *CompLabel.ToString())))
+					.ColorAndOpacity(FLinearColor(0.8f, 0.8f, 0.8f, 1))
+				];
+				UObject* Tmpl = B.ComponentTemplates.FindRef(CompLabel).Get();
+				if (!Tmpl) continue;
+				const FName CompNameForRemoval = Tmpl->GetFName();
+				for (const FName& V : B.ComponentVarsByName[CompLabel])
 				{
-					VB->AddSlot().AutoHeight().Padding(10, 8, 6, 2)
-					[
-						SNew(STextBlock)
-						.Text(FText::FromString(FString::Printf(TEXT("Component: %s"), *CompLabel.ToString())))
-						.ColorAndOpacity(FLinearColor(0.8f, 0.8f, 0.8f, 1))
-					];
-					UObject* Tmpl = B.ComponentTemplates.FindRef(CompLabel).Get();
-					if (!Tmpl) continue;
-					const FName CompNameForRemoval = Tmpl->GetFName();
-					for (const FName& V : B.ComponentVarsByName[CompLabel])
-					{
-						VB->AddSlot().AutoHeight().Padding(16, 2)[EmitPropWithDelete(
-							Tmpl, V, B.ClassName, CompNameForRemoval)];
-					}
+					VB->AddSlot().AutoHeight().Padding(16, 2)[EmitPropWithDelete(
+						Tmpl, V, B.ClassName, CompNameForRemoval)];
 				}
 			}
+		}
 
-			// assets
-			{
-				TArray<FName> AssetLabels;
-				B.AssetVarsByName.GenerateKeyArray(AssetLabels);
-				AssetLabels.Sort(FNameLexicalLess());
+		// assets
+		{
+			TArray<FName> AssetLabels;
+			B.AssetVarsByName.GenerateKeyArray(AssetLabels);
+			AssetLabels.Sort(FNameLexicalLess());
 
-				for (const FName& AName : AssetLabels)
-				{
-					UObject* Obj = B.AssetsByName.FindRef(AName).Get();
-					const FString ParentClass = Obj ? Obj->GetClass()->GetName() : FString();
+			for (const FName& AName : AssetLabels)
+			{
+				UObject* Obj = B.AssetsByName.FindRef(AName).Get();
+				const FString ParentClass = Obj ? Obj->GetClass()->GetName() : PrettyBlueprintDisplayName(
+					FindFirstObjectSafe<UClass>(*B.ClassName.ToString()));
 
-					// Two-line header: AssetName (big) + ParentClass (small, grey)
-					VB->AddSlot().AutoHeight().Padding(10, 8, 6, 2)
+				// Two-line header: AssetName (big) + ParentClass (small, grey)
+				VB->AddSlot().AutoHeight().Padding(10, 8, 6, 2)
+				[
+					SNew(SVerticalBox)
+					+ SVerticalBox::Slot().AutoHeight()
 					[
-						SNew(SVerticalBox)
-						+ SVerticalBox::Slot().AutoHeight()
-						[
-							SNew(STextBlock)
-							.Text(FText::FromName(AName))
-							.Font(FCoreStyle::GetDefaultFontStyle("Bold", 12))
-						]
-						+ SVerticalBox::Slot().AutoHeight()
-						[
-							SNew(STextBlock)
-							.Text(FText::FromString(ParentClass))
-							.Font(FCoreStyle::GetDefaultFontStyle("Regular", 8))
-							.ColorAndOpacity(FLinearColor(0.7f, 0.7f, 0.7f))
-						]
-					];
+						SNew(STextBlock)
+						.Text(FText::FromName(AName))
+						.Font(FCoreStyle::GetDefaultFontStyle("Bold", 12))
+					]
+					+ SVerticalBox::Slot().AutoHeight()
+					[
+						SNew(STextBlock)
+						.Text(FText::FromString(ParentClass))
+						.Font(FCoreStyle::GetDefaultFontStyle("Regular", 8))
+						.ColorAndOpacity(FLinearColor(0.7f, 0.7f, 0.7f))
+					]
+				];
 
-					if (Obj)
+				const FSoftObjectPath AssetPath = B.AssetPathsByName.FindRef(AName);
+				if (Obj)
+				{
+					for (const FName& V : B.AssetVarsByName[AName])
+					{
+						VB->AddSlot().AutoHeight().Padding(16, 2)
+						[
+							EmitPropWithDelete(Obj, V, B.ClassName, NAME_None, AssetPath)
+						];
+					}
+				}
+				else
+				{
+					// not resident yet: tagged values are shown read-only and load the asset only when edited;
+					// the rest wait for the group's async load, which rebuilds these rows
+					const TMap<FName, FString>* Previews = B.AssetPreviewsByName.Find(AName);
+					for (const FName& V : B.AssetVarsByName[AName])
 					{
-						for (const FName& V : B.AssetVarsByName[AName])
+						if (const FString* Preview = Previews ? Previews->Find(V) : nullptr)
 						{
 							VB->AddSlot().AutoHeight().Padding(16, 2)
 							[
-								EmitPropWithDelete(Obj, V, B.ClassName, NAME_None)
+								MakeAssetPreviewRow(B.ClassName, V, *Preview, GroupId, AssetPath)
 							];
+							continue;
 						}
+						VB->AddSlot().AutoHeight().Padding(16, 2)
+						[
+							SNew(SHorizontalBox)
+							+ SHorizontalBox::Slot().FillWidth(1.f).VAlign(VAlign_Center)
+							[
+								SNew(STextBlock)
+								.Text(FText::FromString(FString::Printf(TEXT("%s (loading…)"), *V.ToString())))
+								.ColorAndOpacity(FLinearColor(0.6f, 0.6f, 0.6f))
+							]
+							+ SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Top).Padding(6, 2, 0, 0)
+							[
+								SNew(SButton)
+								.ButtonStyle(FAppStyle::Get(), "FlatButton")
+								.ContentPadding(FMargin(4, 2))
+								.ToolTipText(FText::FromString(TEXT("Remove this variable from the list")))
+								.OnClicked(this, &SPinVarPanel::OnRemovePinned, B.ClassName, V, GroupId,
+								           FName(NAME_None), AssetPath)
+								[
+									SNew(STextBlock).Text(FText::FromString(TEXT("X"))).ColorAndOpacity(FLinearColor::Red)
+								]
+							]
+						];
 					}
 				}
 			}
 		}
-
 		return VB;
 	};
 
-	// small helper to register expand state per path
-	auto RegisterArea = [&](const FString& FullPath, const TSharedRef<SExpandableArea>& Area)
+	// helper: make class sections for one group
+	auto MakeClassSectionsForGroup = [&](const int32 GroupId) -> TSharedRef<SVerticalBox>
 	{
-		const FName Key(*FullPath);
-		if (const bool* Remembered = GroupExpandedState.Find(Key)) { Area->SetExpanded(*Remembered); }
-		GroupAreaWidgets.Add(Key, Area);
+		TRACE_CPUPROFILER_EVENT_SCOPE(PinVar_BuildGroupSection);
+		TSharedRef<SVerticalBox> VB = SNew(SVerticalBox);
+		TMap<FName, FClassBuckets>* ClassesPtr = BuildByGroup.Find(GroupId);
+		if (!ClassesPtr) return VB;
+
+		TArray<FName> ClassOrder;
+		ClassesPtr->GenerateKeyArray(ClassOrder);
+		ClassOrder.Sort([&](const FName& A, const FName& B)
+		{
+			return (*ClassesPtr)[A].ClassLabel.ToString().Compare((*ClassesPtr)[B].ClassLabel.ToString(),
+			                                                      ESearchCase::IgnoreCase) < 0;
+		});
+
+		for (const FName& CN : ClassOrder)
+		{
+			TSharedRef<SBox> Holder = SNew(SBox)[MakeClassSection(GroupId, (*ClassesPtr)[CN])];
+			ClassSectionHolders.Add(TPair<int32, FName>(GroupId, CN), Holder);
+			VB->AddSlot().AutoHeight()[Holder];
+		}
+		return VB;
 	};
 
-	// recursive builder
-	TFunction<TSharedRef<SWidget>(const FString&, const TSharedPtr<FGroupNode>&)> BuildNode =
-		[&](const FString& ParentPath, const TSharedPtr<FGroupNode>& Node)-> TSharedRef<SWidget>
+	// ---------- incremental: swap the sections of OnlyClasses, leave everything else alone ----------
+	if (OnlyClasses)
 	{
-		const FString FullPath = ParentPath.IsEmpty()
-			                         ? Node->Segment.ToString()
-			                         : ParentPath + TEXT("|") + Node->Segment.ToString();
+		if (BrokenPins.Num() != NumBrokenBefore) return false;
 
-		TSharedRef<SVerticalBox> Body = SNew(SVerticalBox);
+		TSet<TPair<int32, FName>> Swapped;
+		for (TPair<int32, TMap<FName, FClassBuckets>>& GroupPair : BuildByGroup)
+		{
+			for (TPair<FName, FClassBuckets>& ClassPair : GroupPair.Value)
+			{
+				const TPair<int32, FName> Key(GroupPair.Key, ClassPair.Key);
+				const TSharedPtr<SBox> Holder = ClassSectionHolders.FindRef(Key).Pin();
+				if (!Holder) return false; // the class now shows up in a group it had no section in
 
-		// sections at this exact path
-		Body->AddSlot().AutoHeight().Padding(6, 6)[MakeClassSectionsForPath(FullPath)];
+				Holder->SetContent(MakeClassSection(GroupPair.Key, ClassPair.Value));
+				Swapped.Add(Key);
+			}
+		}
+
+		// every pin of the class left this group (e.g. its properties went away)
+		for (const TPair<TPair<int32, FName>, TWeakPtr<SBox>>& It : ClassSectionHolders)
+		{
+			if (!OnlyClasses->Contains(It.Key.Value) || Swapped.Contains(It.Key)) continue;
+			if (GroupTable.Resolve(It.Key.Key) == 0) return false; // the group itself went away with its last pin
+			if (const TSharedPtr<SBox> Holder = It.Value.Pin())
+			{
+				Holder->SetContent(SNullWidget::NullWidget);
+			}
+		}
+		return true;
+	}
+
+	// small helper to register expand state per group
+	auto RegisterArea = [&](const int32 GroupId, const TSharedRef<SExpandableArea>& Area)
+	{
+		if (const bool* Remembered = GroupExpandedState.Find(GroupId))
+		{
+			Area->SetExpanded(*Remembered);
+			if (*Remembered) { RequestGroupAssets(GroupId); }
+		}
+		GroupAreaWidgets.Add(GroupId, Area);
+		WatchGroupHover(GroupId, Area);
+	};
+
+	// recursive builder: sections pinned directly to the group, then an area per subgroup
+	TFunction<TSharedRef<SWidget>(const TSharedPtr<FGroupNode>&)> BuildNode =
+		[&](const TSharedPtr<FGroupNode>& Node)-> TSharedRef<SWidget>
+	{
+		TSharedRef<SVerticalBox> Body = SNew(SVerticalBox);
+		Body->AddSlot().AutoHeight().Padding(6, 6)[MakeClassSectionsForGroup(Node->GroupId)];
 
-		// children
 		TArray<FName> ChildKeys;
 		Node->Children.GenerateKeyArray(ChildKeys);
 		ChildKeys.Sort(FNameLexicalLess());
@@ -961,16 +1444,17 @@ void SPinVarPanel::GatherPinnedProperties()
 			TSharedRef<SExpandableArea> ChildArea =
 				SNew(SExpandableArea)
 				.InitiallyCollapsed(true)
+				.OnAreaExpansionChanged(this, &SPinVarPanel::OnGroupExpansionChanged, Child->GroupId)
 				.HeaderContent()
 				[
-					SNew(STextBlock).Text(FText::FromName(ChildSeg))
+					MakeGroupHeader(Child->GroupId)
 				]
 				.BodyContent()
 				[
-					BuildNode(FullPath, Child)
+					BuildNode(Child)
 				];
 
-			RegisterArea(FullPath + TEXT("|") + ChildSeg.ToString(), ChildArea);
+			RegisterArea(Child->GroupId, ChildArea);
 			Body->AddSlot().AutoHeight().Padding(12, 4, 0, 0)[ChildArea];
 		}
 		return Body;
@@ -988,36 +1472,9 @@ void SPinVarPanel::GatherPinnedProperties()
 		if (!Root) continue;
 
 		// composite body that Rebuild() will put inside the top-level area
-		TSharedRef<SVerticalBox> RootBody = SNew(SVerticalBox);
-
-		// sections pinned directly to the root
-		RootBody->AddSlot().AutoHeight().Padding(6, 6)[MakeClassSectionsForPath(RootSeg.ToString())];
-
-		// children areas
-		TArray<FName> ChildKeys;
-		Root->Children.GenerateKeyArray(ChildKeys);
-		ChildKeys.Sort(FNameLexicalLess());
-		for (const FName& ChildSeg : ChildKeys)
-		{
-			const TSharedPtr<FGroupNode>& Child = Root->Children[ChildSeg];
-			TSharedRef<SExpandableArea> Area =
-				SNew(SExpandableArea)
-				.InitiallyCollapsed(true)
-				.HeaderContent()
-				[
-					SNew(STextBlock).Text(FText::FromName(ChildSeg))
-				]
-				.BodyContent()
-				[
-					BuildNode(RootSeg.ToString(), Child)
-				];
-
-			RegisterArea(RootSeg.ToString() + TEXT("|") + ChildSeg.ToString(), Area);
-			RootBody->AddSlot().AutoHeight().Padding(12, 4, 0, 0)[Area];
-		}
-
-		Grouped.FindOrAdd(RootSeg).Add({RootSeg, RootBody});
+		Grouped.FindOrAdd(RootSeg).Add({RootSeg, Root->GroupId, BuildNode(Root)});
 	}
+	return true;
 }
 
 
@@ -1047,20 +1504,671 @@ void SPinVarPanel::OnAnyAssetPicked(const FAssetData& AssetData)
 	}
 }
 
-FReply SPinVarPanel::OnRemovePinned(FName Class, FName VarName, FName GroupName, FName CompName)
+FReply SPinVarPanel::OnRemovePinned(FName Class, FName VarName, int32 GroupId, FName CompName,
+                                    FSoftObjectPath AssetPath)
 {
 	if (GEditor)
 	{
 		if (UPinVarSubsystem* Subsystem = GEditor->GetEditorSubsystem<UPinVarSubsystem>())
 		{
-			
-			Subsystem->UnstagePinVariable(Class, VarName, GroupName, CompName);
-			Subsystem->MergeStagedIntoPinned();
-			Subsystem->SaveToDisk();
+			{
+				FPinVarPinTransaction Transaction(Subsystem, FText::FromString(TEXT("PinVar: Unpin Variable")));
+				Subsystem->UnstagePinVariable(Class, VarName, GroupId, CompName, AssetPath);
+				Subsystem->MergeStagedIntoPinned();
+				Subsystem->SaveToDisk();
+			}
 			Refresh(); // rebuild UI
 		}
 	}
-	return FReply::Handled();
+	return FReply::Handled();
+}
+
+TSharedRef<SWidget> SPinVarPanel::MakeGroupHeader(int32 GroupId)
+{
+	TWeakObjectPtr<UPinVarSubsystem> WeakSubsystem = GEditor ? GEditor->GetEditorSubsystem<UPinVarSubsystem>() : nullptr;
+	return SNew(SHorizontalBox)
+		+ SHorizontalBox::Slot().FillWidth(1.f).VAlign(VAlign_Center)
+		[
+			SNew(STextBlock)
+			.Text_Lambda([WeakSubsystem, GroupId]()
+			{
+				const UPinVarSubsystem* Subsystem = WeakSubsystem.Get();
+				return FText::FromName(Subsystem ? Subsystem->GroupTable.GetName(GroupId) : NAME_None);
+			})
+		]
+		+ SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Center)
+		[
+			SNew(SButton)
+			.ButtonStyle(FAppStyle::Get(), "FlatButton")
+			.ContentPadding(FMargin(4, 0))
+			.ToolTipText(FText::FromString(TEXT("Rename or move this group, or save / apply value presets")))
+			.OnClicked_Lambda([this, GroupId]()
+			{
+				ShowEditGroupDialog(GroupId);
+				return FReply::Handled();
+			})
+			[
+				SNew(STextBlock).Text(FText::FromString(TEXT("…")))
+			]
+		];
+}
+
+void SPinVarPanel::ShowEditGroupDialog(int32 GroupId)
+{
+	UPinVarSubsystem* Subsystem = GEditor ? GEditor->GetEditorSubsystem<UPinVarSubsystem>() : nullptr;
+	const FPinVarGroup* Group = Subsystem ? Subsystem->GroupTable.Find(GroupId) : nullptr;
+	if (!Group) return;
+
+	struct FEdit
+	{
+		FString Name;
+		FString Parent;
+		FString PresetName;
+		TArray<TSharedPtr<FString>> PresetOpts;
+		TSharedPtr<FString> PresetSel;
+	};
+	TSharedRef<FEdit> Edit = MakeShared<FEdit>();
+	Edit->Name = Group->Name.ToString();
+	Edit->Parent = Group->ParentId ? Subsystem->GroupTable.GetPath(Group->ParentId) : FString();
+	Edit->PresetName = Edit->Name;
+	{
+		TArray<FString> Names;
+		UPinVarSubsystem::GetPresetNames(Names);
+		for (FString& N : Names) { Edit->PresetOpts.Add(MakeShared<FString>(MoveTemp(N))); }
+		if (Edit->PresetOpts.Num()) Edit->PresetSel = Edit->PresetOpts[0];
+	}
+
+	TSharedRef<SWindow> Dialog = SNew(SWindow)
+		.Title(FText::FromString(TEXT("Edit Group")))
+		.SupportsMaximize(false)
+		.SupportsMinimize(false)
+		.ClientSize(FVector2D(420, 290));
+
+	Dialog->SetContent(
+		SNew(SVerticalBox)
+		+ SVerticalBox::Slot().AutoHeight().Padding(8, 8, 8, 2)
+		[
+			SNew(STextBlock).Text(FText::FromString(TEXT("Name")))
+		]
+		+ SVerticalBox::Slot().AutoHeight().Padding(8, 0)
+		[
+			SNew(SEditableTextBox)
+			.Text(FText::FromString(Edit->Name))
+			.OnTextChanged_Lambda([Edit](const FText& T) { Edit->Name = T.ToString(); })
+		]
+		+ SVerticalBox::Slot().AutoHeight().Padding(8, 8, 8, 2)
+		[
+			SNew(STextBlock)
+			.Text(FText::FromString(TEXT("Parent group (empty = top level). An existing name there merges.")))
+		]
+		+ SVerticalBox::Slot().AutoHeight().Padding(8, 0)
+		[
+			SNew(SEditableTextBox)
+			.Text(FText::FromString(Edit->Parent))
+			.OnTextChanged_Lambda([Edit](const FText& T) { Edit->Parent = T.ToString(); })
+		]
+		+ SVerticalBox::Slot().AutoHeight().HAlign(HAlign_Right).Padding(8)
+		[
+			SNew(SButton)
+			.Text(FText::FromString(TEXT("Apply")))
+			.OnClicked_Lambda([Edit, GroupId, Dialog]()
+			{
+				if (UPinVarSubsystem* Subsystem = GEditor ? GEditor->GetEditorSubsystem<UPinVarSubsystem>() : nullptr)
+				{
+					const FString NewName = Edit->Name.TrimStartAndEnd();
+					bool bChanged = false;
+					if (!NewName.IsEmpty() && !NewName.Contains(TEXT("|")) && !NewName.Contains(TEXT(",")))
+					{
+						bChanged |= Subsystem->RenameGroup(GroupId, FName(*NewName));
+					}
+					const FString ParentPath = Edit->Parent.TrimStartAndEnd();
+					const int32 ParentId = ParentPath.IsEmpty() ? 0 : Subsystem->GroupTable.FindOrAddPath(ParentPath);
+					bChanged |= Subsystem->MoveGroup(GroupId, ParentId);
+					if (bChanged)
+					{
+						Subsystem->MergeStagedIntoPinned();
+						Subsystem->SaveToDisk();
+					}
+				}
+				Dialog->RequestDestroyWindow();
+				return FReply::Handled();
+			})
+		]
+		+ SVerticalBox::Slot().AutoHeight().Padding(8, 4)
+		[
+			SNew(SSeparator)
+		]
+		// value presets: snapshot this group's values, or apply any saved snapshot as one undo step
+		+ SVerticalBox::Slot().AutoHeight().Padding(8, 4, 8, 2)
+		[
+			SNew(STextBlock).Text(FText::FromString(TEXT("Value presets (this group and its subgroups)")))
+		]
+		+ SVerticalBox::Slot().AutoHeight().Padding(8, 0)
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot().FillWidth(1.f).VAlign(VAlign_Center)
+			[
+				SNew(SEditableTextBox)
+				.Text(FText::FromString(Edit->PresetName))
+				.OnTextChanged_Lambda([Edit](const FText& T) { Edit->PresetName = T.ToString(); })
+			]
+			+ SHorizontalBox::Slot().AutoWidth().Padding(8, 0, 0, 0).VAlign(VAlign_Center)
+			[
+				SNew(SButton)
+				.Text(FText::FromString(TEXT("Save values")))
+				.IsEnabled_Lambda([Edit]() { return !Edit->PresetName.TrimStartAndEnd().IsEmpty(); })
+				.OnClicked_Lambda([Edit, GroupId, Dialog]()
+				{
+					if (UPinVarSubsystem* Subsystem = GEditor ? GEditor->GetEditorSubsystem<UPinVarSubsystem>() : nullptr)
+					{
+						Subsystem->SavePreset(GroupId, Edit->PresetName);
+					}
+					Dialog->RequestDestroyWindow();
+					return FReply::Handled();
+				})
+			]
+		]
+		+ SVerticalBox::Slot().AutoHeight().Padding(8, 6, 8, 8)
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot().FillWidth(1.f).VAlign(VAlign_Center)
+			[
+				SNew(SSearchableComboBox)
+				.OptionsSource(&Edit->PresetOpts)
+				.OnGenerateWidget_Lambda([](TSharedPtr<FString> It)
+				{
+					return SNew(STextBlock).Text(FText::FromString(It.IsValid() ? *It : TEXT("None")));
+				})
+				.OnSelectionChanged_Lambda([Edit](TSharedPtr<FString> NewSel, ESelectInfo::Type)
+				{
+					Edit->PresetSel = NewSel;
+				})
+				.InitiallySelectedItem(Edit->PresetSel)
+				[
+					SNew(STextBlock)
+					.Text_Lambda([Edit]()
+					{
+						return Edit->PresetSel.IsValid()
+							       ? FText::FromString(*Edit->PresetSel)
+							       : FText::FromString(TEXT("No presets saved"));
+					})
+				]
+			]
+			+ SHorizontalBox::Slot().AutoWidth().Padding(8, 0, 0, 0).VAlign(VAlign_Center)
+			[
+				SNew(SButton)
+				.Text(FText::FromString(TEXT("Apply preset")))
+				.IsEnabled_Lambda([Edit]() { return Edit->PresetSel.IsValid(); })
+				.OnClicked_Lambda([Edit, Dialog]()
+				{
+					if (UPinVarSubsystem* Subsystem = GEditor ? GEditor->GetEditorSubsystem<UPinVarSubsystem>() : nullptr)
+					{
+						Subsystem->ApplyPreset(*Edit->PresetSel);
+					}
+					Dialog->RequestDestroyWindow();
+					return FReply::Handled();
+				})
+			]
+		]);
+
+	FSlateApplication::Get().AddWindow(Dialog);
+}
+
+void SPinVarPanel::OnGroupsChanged(int32 GroupId, bool bRenameOnly)
+{
+	// headers bind to the record and all panel state is keyed by id, so a rename needs no widget work
+	if (bRenameOnly) return;
+	Refresh();
+}
+
+TSharedRef<SWidget> SPinVarPanel::MakeAssetPreviewRow(FName ClassName, FName VarName, const FString& Preview,
+                                                     int32 GroupId, const FSoftObjectPath& AssetPath)
+{
+	return SNew(SHorizontalBox)
+		+ SHorizontalBox::Slot().FillWidth(0.4f).VAlign(VAlign_Center)
+		[
+			SNew(STextBlock).Text(FText::FromName(VarName))
+		]
+		+ SHorizontalBox::Slot().FillWidth(0.6f).VAlign(VAlign_Center)
+		[
+			SNew(STextBlock)
+			.Text(FText::FromString(Preview))
+			.ToolTipText(FText::FromString(TEXT("From the asset registry; the asset is not loaded")))
+			.ColorAndOpacity(FLinearColor(0.6f, 0.6f, 0.6f))
+		]
+		+ SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Center).Padding(6, 0, 0, 0)
+		[
+			SNew(SButton)
+			.ButtonStyle(FAppStyle::Get(), "FlatButton")
+			.ContentPadding(FMargin(4, 2))
+			.ToolTipText(FText::FromString(TEXT("Load the asset to edit its values")))
+			.IsEnabled_Lambda([this, AssetPath]()
+			{
+				const TSharedPtr<FStreamableHandle>* Handle = EditLoadHandles.Find(AssetPath);
+				return !Handle || !Handle->IsValid() || !(*Handle)->IsLoadingInProgress();
+			})
+			.OnClicked_Lambda([this, AssetPath, ClassName]()
+			{
+				RequestAssetForEdit(AssetPath, ClassName);
+				return FReply::Handled();
+			})
+			[
+				SNew(STextBlock).Text(FText::FromString(TEXT("Edit")))
+			]
+		]
+		+ SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Top).Padding(6, 2, 0, 0)
+		[
+			SNew(SButton)
+			.ButtonStyle(FAppStyle::Get(), "FlatButton")
+			.ContentPadding(FMargin(4, 2))
+			.ToolTipText(FText::FromString(TEXT("Remove this variable from the list")))
+			.OnClicked(this, &SPinVarPanel::OnRemovePinned, ClassName, VarName, GroupId, FName(NAME_None), AssetPath)
+			[
+				SNew(STextBlock).Text(FText::FromString(TEXT("X"))).ColorAndOpacity(FLinearColor::Red)
+			]
+		];
+}
+
+void SPinVarPanel::RequestAssetForEdit(const FSoftObjectPath& AssetPath, FName ClassName)
+{
+	if (const TSharedPtr<FStreamableHandle>* Existing = EditLoadHandles.Find(AssetPath))
+	{
+		if (Existing->IsValid() && (*Existing)->IsLoadingInProgress()) return;
+	}
+
+	INC_DWORD_STAT(STAT_PinVar_AssetsRequested);
+	TWeakPtr<SPinVarPanel> WeakThis = SharedThis(this);
+	EditLoadHandles.Add(AssetPath, UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		                    AssetPath, FStreamableDelegate::CreateLambda([WeakThis, ClassName]()
+		                    {
+			                    INC_DWORD_STAT(STAT_PinVar_AssetsLoaded);
+			                    TSharedPtr<SPinVarPanel> Panel = WeakThis.Pin();
+			                    if (!Panel) return;
+
+			                    // swap in the editable rows of just this class once the load callback has returned
+			                    Panel->RegisterActiveTimer(0.f, FWidgetActiveTimerDelegate::CreateLambda(
+				                                               [WeakThis, ClassName](double, float)
+				                                               {
+					                                               if (TSharedPtr<SPinVarPanel> P = WeakThis.Pin())
+					                                               {
+						                                               P->RefreshClasses({ClassName});
+					                                               }
+					                                               return EActiveTimerReturnType::Stop;
+				                                               }));
+		                    })));
+}
+
+FReply SPinVarPanel::OnExportValuesCsv()
+{
+	if (UPinVarSubsystem* Subsystem = GEditor ? GEditor->GetEditorSubsystem<UPinVarSubsystem>() : nullptr)
+	{
+		Subsystem->ExportValuesCsv(UPinVarSubsystem::GetValuesCsvPath());
+	}
+	return FReply::Handled();
+}
+
+FReply SPinVarPanel::OnImportValuesCsv()
+{
+	UPinVarSubsystem* Subsystem = GEditor ? GEditor->GetEditorSubsystem<UPinVarSubsystem>() : nullptr;
+	if (!Subsystem) return FReply::Handled();
+
+	TArray<FPinVarValueChange> Changes;
+	int32 RowsRead = 0;
+	int32 RowsSkipped = 0;
+	if (Subsystem->ReadValuesCsv(UPinVarSubsystem::GetValuesCsvPath(), Changes, RowsRead, RowsSkipped))
+	{
+		ShowValuesImportDialog(MoveTemp(Changes), RowsSkipped);
+	}
+	return FReply::Handled();
+}
+
+void SPinVarPanel::ShowValuesImportDialog(TArray<FPinVarValueChange>&& Changes, int32 RowsSkipped)
+{
+	// shared with the list (rows are virtualized, so a large import only builds what is on screen)
+	struct FImport
+	{
+		TArray<FPinVarValueChange> Changes;
+		TArray<TSharedPtr<int32>> Rows;
+	};
+	TSharedRef<FImport> Import = MakeShared<FImport>();
+	Import->Changes = MoveTemp(Changes);
+	Import->Rows.Reserve(Import->Changes.Num());
+	for (int32 i = 0; i < Import->Changes.Num(); ++i) { Import->Rows.Add(MakeShared<int32>(i)); }
+
+	TSharedRef<SWindow> Dialog = SNew(SWindow)
+		.Title(FText::FromString(TEXT("Import Values")))
+		.SupportsMinimize(false)
+		.ClientSize(FVector2D(720, 420));
+
+	Dialog->SetContent(
+		SNew(SVerticalBox)
+		+ SVerticalBox::Slot().AutoHeight().Padding(8)
+		[
+			SNew(STextBlock)
+			.Text(FText::FromString(FString::Printf(TEXT("%d values differ from the CSV. %d rows skipped (not pinned or not resolvable)."),
+			                                        Import->Changes.Num(), RowsSkipped)))
+		]
+		+ SVerticalBox::Slot().FillHeight(1.f).Padding(8, 0)
+		[
+			SNew(SListView<TSharedPtr<int32>>)
+			.ListItemsSource(&Import->Rows)
+			.OnGenerateRow_Lambda([Import](TSharedPtr<int32> Row, const TSharedRef<STableViewBase>& Owner)
+			{
+				const FPinVarValueChange& C = Import->Changes[*Row];
+				const UObject* Target = C.Write.Target.Get();
+				return SNew(STableRow<TSharedPtr<int32>>, Owner)
+				[
+					SNew(STextBlock)
+					.Text(FText::FromString(FString::Printf(TEXT("%s  %s.%s:  %s  →  %s"),
+					                                        *C.ClassName.ToString(),
+					                                        Target ? *Target->GetName() : TEXT("?"),
+					                                        *C.Write.VariableName.ToString(),
+					                                        *C.OldValue, *C.Write.ValueText)))
+				];
+			})
+		]
+		+ SVerticalBox::Slot().AutoHeight().HAlign(HAlign_Right).Padding(8)
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot().AutoWidth()
+			[
+				SNew(SButton)
+				.ButtonStyle(FAppStyle::Get(), "PrimaryButton")
+				.IsEnabled(Import->Changes.Num() > 0)
+				.Text(FText::FromString(FString::Printf(TEXT("Apply %d changes"), Import->Changes.Num())))
+				.OnClicked_Lambda([Import, Dialog]()
+				{
+					if (UPinVarSubsystem* Subsystem = GEditor ? GEditor->GetEditorSubsystem<UPinVarSubsystem>() : nullptr)
+					{
+						TArray<FPinVarValueWrite> Writes;
+						Writes.Reserve(Import->Changes.Num());
+						for (FPinVarValueChange& C : Import->Changes) { Writes.Add(MoveTemp(C.Write)); }
+						Subsystem->ApplyValueBatch(Writes, FText::FromString(TEXT("PinVar: Import Values CSV")));
+					}
+					Dialog->RequestDestroyWindow();
+					return FReply::Handled();
+				})
+			]
+			+ SHorizontalBox::Slot().AutoWidth().Padding(8, 0, 0, 0)
+			[
+				SNew(SButton)
+				.Text(FText::FromString(TEXT("Cancel")))
+				.OnClicked_Lambda([Dialog]()
+				{
+					Dialog->RequestDestroyWindow();
+					return FReply::Handled();
+				})
+			]
+		]);
+
+	FSlateApplication::Get().AddWindow(Dialog);
+}
+
+void SPinVarPanel::OnGroupExpansionChanged(bool bExpanded, int32 GroupKey)
+{
+	// subgroups are shown or hidden with their parent
+	const UPinVarSubsystem* Subsystem = GEditor ? GEditor->GetEditorSubsystem<UPinVarSubsystem>() : nullptr;
+	TArray<int32> Nested;
+	for (const TPair<int32, TWeakPtr<SExpandableArea>>& Pair : GroupAreaWidgets)
+	{
+		if (Subsystem && Subsystem->GroupTable.IsAncestorOf(GroupKey, Pair.Key)) Nested.Add(Pair.Key);
+	}
+
+	if (bExpanded)
+	{
+		// the group handle now holds whatever a prefetch already loaded (or is still loading)
+		RequestGroupAssets(GroupKey);
+		CancelPrefetch(GroupKey);
+		NearViewGroups.Remove(GroupKey);
+		for (const int32 Id : Nested)
+		{
+			if (IsGroupExpanded(Id)) RequestGroupAssets(Id);
+		}
+	}
+	else
+	{
+		ReleaseGroupAssets(GroupKey);
+		for (const int32 Id : Nested) { ReleaseGroupAssets(Id); }
+	}
+}
+
+bool SPinVarPanel::IsGroupExpanded(int32 GroupKey) const
+{
+	const TSharedPtr<SExpandableArea> Area = GroupAreaWidgets.FindRef(GroupKey).Pin();
+	return Area.IsValid() && Area->IsExpanded();
+}
+
+void SPinVarPanel::RequestGroupAssets(int32 GroupKey)
+{
+	const TSet<FSoftObjectPath>* Assets = AssetsByGroup.Find(GroupKey);
+	if (!Assets || Assets->Num() == 0) return;
+
+	TSharedPtr<FStreamableHandle>& Handle = GroupLoadHandles.FindOrAdd(GroupKey);
+	if (Handle.IsValid() && Handle->IsLoadingInProgress()) return;
+
+	// nothing to do if the current handle already holds every asset and all of them are resident
+	TArray<FSoftObjectPath> Held;
+	if (Handle.IsValid() && Handle->IsActive()) Handle->GetRequestedAssets(Held);
+	const TSet<FSoftObjectPath> HeldSet(Held);
+	int32 NumMissing = 0;
+	bool bAllHeld = true;
+	for (const FSoftObjectPath& Path : *Assets)
+	{
+		if (!Path.ResolveObject()) ++NumMissing;
+		bAllHeld &= HeldSet.Contains(Path);
+	}
+	if (bAllHeld && NumMissing == 0) return;
+
+	// assets still resident from an earlier expand are only re-held; rows need rebuilding only for the missing
+	INC_DWORD_STAT_BY(STAT_PinVar_AssetsRequested, NumMissing);
+	TSharedPtr<FStreamableHandle> Previous = MoveTemp(Handle);
+	Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		Assets->Array(),
+		NumMissing > 0
+			? FStreamableDelegate::CreateSP(this, &SPinVarPanel::OnGroupAssetsLoaded, NumMissing)
+			: FStreamableDelegate());
+	UPinVarSubsystem::ReleaseLoadHandle(Previous);
+}
+
+void SPinVarPanel::ReleaseGroupAssets(int32 GroupKey)
+{
+	if (TSharedPtr<FStreamableHandle>* Handle = GroupLoadHandles.Find(GroupKey))
+	{
+		UPinVarSubsystem::ReleaseLoadHandle(*Handle);
+		GroupLoadHandles.Remove(GroupKey);
+	}
+
+	// edit loads go too, unless another open group still shows the asset
+	const TSet<FSoftObjectPath>* Assets = AssetsByGroup.Find(GroupKey);
+	if (!Assets) return;
+	for (auto It = EditLoadHandles.CreateIterator(); It; ++It)
+	{
+		if (!Assets->Contains(It.Key())) continue;
+
+		bool bShownElsewhere = false;
+		for (const TPair<int32, TSet<FSoftObjectPath>>& Other : AssetsByGroup)
+		{
+			if (Other.Key != GroupKey && Other.Value.Contains(It.Key()) && IsGroupExpanded(Other.Key))
+			{
+				bShownElsewhere = true;
+				break;
+			}
+		}
+		if (bShownElsewhere) continue;
+
+		UPinVarSubsystem::ReleaseLoadHandle(It.Value());
+		It.RemoveCurrent();
+	}
+}
+
+void SPinVarPanel::OnGroupAssetsLoaded(int32 NumAssets)
+{
+	INC_DWORD_STAT_BY(STAT_PinVar_AssetsLoaded, NumAssets);
+
+	// coalesce completions (and stay out of an in-flight Rebuild) by deferring to the next tick
+	if (bDeferredRebuildPending) return;
+	bDeferredRebuildPending = true;
+
+	RegisterActiveTimer(0.f, FWidgetActiveTimerDelegate::CreateLambda(
+		                    [WeakThis = TWeakPtr<SPinVarPanel>(SharedThis(this))](double, float)
+		                    {
+			                    if (TSharedPtr<SPinVarPanel> Panel = WeakThis.Pin())
+			                    {
+				                    Panel->bDeferredRebuildPending = false;
+				                    Panel->Rebuild();
+			                    }
+			                    return EActiveTimerReturnType::Stop;
+		                    }));
+}
+
+void SPinVarPanel::WatchGroupHover(int32 GroupKey, const TSharedRef<SExpandableArea>& Area)
+{
+	// the whole area, so moving onto the expand arrow does not count as leaving; expanded groups ignore it
+	Area->SetOnMouseEnter(FNoReplyPointerEventHandler::CreateLambda(
+		[this, GroupKey](const FGeometry&, const FPointerEvent&) { OnGroupHoverChanged(GroupKey, true); }));
+	Area->SetOnMouseLeave(FSimpleNoReplyPointerEventHandler::CreateLambda(
+		[this, GroupKey](const FPointerEvent&) { OnGroupHoverChanged(GroupKey, false); }));
+}
+
+void SPinVarPanel::OnGroupHoverChanged(int32 GroupKey, bool bHovered)
+{
+	if (!bHovered)
+	{
+		if (HoveredGroup == GroupKey) HoveredGroup = 0;
+		if (!NearViewGroups.Contains(GroupKey)) CancelPrefetch(GroupKey);
+		return;
+	}
+
+	// a short dwell, so sweeping the pointer down the list does not start (and drop) a load per header
+	HoveredGroup = GroupKey;
+	RegisterActiveTimer(0.1f, FWidgetActiveTimerDelegate::CreateLambda(
+		                    [WeakThis = TWeakPtr<SPinVarPanel>(SharedThis(this)), GroupKey](double, float)
+		                    {
+			                    if (TSharedPtr<SPinVarPanel> Panel = WeakThis.Pin())
+			                    {
+				                    if (Panel->HoveredGroup == GroupKey) Panel->PrefetchGroupAssets(GroupKey);
+			                    }
+			                    return EActiveTimerReturnType::Stop;
+		                    }));
+}
+
+void SPinVarPanel::UpdateScrollPrefetch()
+{
+	if (!ListScrollBox.IsValid() || !RootBox.IsValid()) return;
+
+	// collapsed top-level groups within half a viewport of the visible area, nearest first, from last frame's layout
+	const FGeometry& View = ListScrollBox->GetCachedGeometry();
+	const float ViewHeight = View.GetAbsoluteSize().Y;
+	const float ViewCenter = View.GetAbsolutePosition().Y + ViewHeight * 0.5f;
+
+	TMap<const SWidget*, int32> GroupByArea;
+	for (const TPair<int32, TWeakPtr<SExpandableArea>>& Pair : GroupAreaWidgets)
+	{
+		if (const TSharedPtr<SExpandableArea> Area = Pair.Value.Pin()) GroupByArea.Add(Area.Get(), Pair.Key);
+	}
+
+	FArrangedChildren Arranged(EVisibility::Visible);
+	RootBox->ArrangeChildren(RootBox->GetCachedGeometry(), Arranged);
+	TArray<TPair<float, int32>> Near;
+	for (int32 Index = 0; Index < Arranged.Num(); ++Index)
+	{
+		const FArrangedWidget& Child = Arranged[Index];
+		const int32* GroupKey = GroupByArea.Find(&Child.Widget.Get());
+		if (!GroupKey || IsGroupExpanded(*GroupKey) || !AssetsByGroup.Contains(*GroupKey)) continue;
+
+		const float Distance = FMath::Abs(Child.Geometry.GetAbsolutePosition().Y - ViewCenter);
+		if (Distance <= ViewHeight) Near.Emplace(Distance, *GroupKey);
+	}
+	Near.Sort([](const TPair<float, int32>& A, const TPair<float, int32>& B) { return A.Key < B.Key; });
+
+	// a screenful of collapsed headers can cover most of a project, so scrolling alone prefetches a bounded amount
+	constexpr int32 MaxScrollPrefetchAssets = 32;
+	int32 Budget = MaxScrollPrefetchAssets;
+	TSet<int32> Wanted;
+	for (const TPair<float, int32>& Entry : Near)
+	{
+		const TSet<FSoftObjectPath>& Assets = AssetsByGroup[Entry.Value];
+		bool bAnyMissing = PrefetchHandles.Contains(Entry.Value);
+		for (auto It = Assets.CreateConstIterator(); It && !bAnyMissing; ++It)
+		{
+			bAnyMissing = !It->ResolveObject();
+		}
+		if (!bAnyMissing) continue;
+		if (Assets.Num() > Budget) break;
+
+		Budget -= Assets.Num();
+		Wanted.Add(Entry.Value);
+	}
+
+	for (const int32 GroupKey : NearViewGroups)
+	{
+		if (!Wanted.Contains(GroupKey) && GroupKey != HoveredGroup) CancelPrefetch(GroupKey);
+	}
+	for (const int32 GroupKey : Wanted)
+	{
+		PrefetchGroupAssets(GroupKey);
+	}
+	NearViewGroups = MoveTemp(Wanted);
+}
+
+void SPinVarPanel::PrefetchGroupAssets(int32 GroupKey)
+{
+	if (PrefetchHandles.Contains(GroupKey) || IsGroupExpanded(GroupKey)) return;
+	const TSet<FSoftObjectPath>* Assets = AssetsByGroup.Find(GroupKey);
+	if (!Assets) return;
+
+	int32 NumMissing = 0;
+	for (const FSoftObjectPath& Path : *Assets)
+	{
+		if (!Path.ResolveObject()) ++NumMissing;
+	}
+	if (NumMissing == 0) return;
+
+	// completion refreshes only the affected class sections, so the collapsed body has its rows when opened
+	INC_DWORD_STAT_BY(STAT_PinVar_AssetsPrefetched, NumMissing);
+	PrefetchHandles.Add(GroupKey, UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		                    Assets->Array(),
+		                    FStreamableDelegate::CreateSP(this, &SPinVarPanel::OnGroupPrefetched, GroupKey, NumMissing)));
+}
+
+void SPinVarPanel::OnGroupPrefetched(int32 GroupKey, int32 NumAssets)
+{
+	INC_DWORD_STAT_BY(STAT_PinVar_AssetsLoaded, NumAssets);
+	if (const TSet<FName>* Classes = AssetClassesByGroup.Find(GroupKey))
+	{
+		PrefetchedClasses.Append(*Classes);
+	}
+
+	// several prefetches often finish together while scrolling; one partial gather covers them all
+	if (PrefetchedClasses.Num() == 0 || bPrefetchRefreshPending) return;
+	bPrefetchRefreshPending = true;
+
+	RegisterActiveTimer(0.f, FWidgetActiveTimerDelegate::CreateLambda(
+		                    [WeakThis = TWeakPtr<SPinVarPanel>(SharedThis(this))](double, float)
+		                    {
+			                    if (TSharedPtr<SPinVarPanel> Panel = WeakThis.Pin())
+			                    {
+				                    Panel->bPrefetchRefreshPending = false;
+				                    const TSet<FName> Classes = MoveTemp(Panel->PrefetchedClasses);
+				                    Panel->PrefetchedClasses.Reset();
+				                    // a pending full rebuild (or the table view) picks the assets up anyway
+				                    if (!Panel->bDeferredRebuildPending && !Panel->bTableMode &&
+					                    !Panel->GatherPinnedProperties(&Classes))
+				                    {
+					                    Panel->Rebuild();
+				                    }
+			                    }
+			                    return EActiveTimerReturnType::Stop;
+		                    }));
+}
+
+void SPinVarPanel::CancelPrefetch(int32 GroupKey)
+{
+	if (TSharedPtr<FStreamableHandle>* Handle = PrefetchHandles.Find(GroupKey))
+	{
+		UPinVarSubsystem::ReleaseLoadHandle(*Handle);
+		PrefetchHandles.Remove(GroupKey);
+	}
 }
 
 FReply SPinVarPanel::OnAddBlueprintVariableClicked()
@@ -1149,11 +2257,18 @@ void SPinVarPanel::ShowAddDialogForDataAsset(UObject* DataAssetInstance)
 	if (S->ExistingGroupOpts.Num())
 		S->ExistingGroupSel = S->ExistingGroupOpts[0];
 
+	// registry-only count for the "all assets of class" option
+	{
+		TArray<FSoftObjectPath> Paths;
+		UPinVarSubsystem::GatherAssetPathsOfClass(TargetClass, Paths);
+		S->NumAssetsOfClass = Paths.Num();
+	}
+
 	TSharedRef<SWindow> Dialog = SNew(SWindow)
 		.Title(FText::FromString(TEXT("Add Variable to Group")))
 		.SupportsMaximize(false)
 		.SupportsMinimize(false)
-		.ClientSize(FVector2D(520, 320));
+		.ClientSize(FVector2D(520, 350));
 
 	AddVariableWindow = Dialog;
 
@@ -1243,6 +2358,31 @@ void SPinVarPanel::ShowAddDialogForDataAsset(UObject* DataAssetInstance)
 			]
 		]
 
+		+ SVerticalBox::Slot().AutoHeight().Padding(12, 6, 12, 4)
+		[
+			MakeNestedPathField(S)
+		]
+
+		// Target: picked instance or every asset of its class
+		+ SVerticalBox::Slot().AutoHeight().Padding(12, 8, 12, 0)
+		[
+			SNew(SCheckBox)
+			.IsChecked_Lambda([S]()
+			{
+				return S->bAllAssetsOfClass ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+			})
+			.OnCheckStateChanged_Lambda([S](ECheckBoxState NewState)
+			{
+				S->bAllAssetsOfClass = (NewState == ECheckBoxState::Checked);
+			})
+			[
+				SNew(STextBlock)
+				.Text(FText::FromString(FString::Printf(TEXT("Pin across all assets of %s (%d)"),
+				                                        *PrettyBlueprintDisplayName(TargetClass),
+				                                        S->NumAssetsOfClass)))
+			]
+		]
+
 		// Group name
 		+ SVerticalBox::Slot().AutoHeight().Padding(12, 10, 12, 8)
 		[
@@ -1310,17 +2450,30 @@ void SPinVarPanel::ShowAddDialogForDataAsset(UObject* DataAssetInstance)
 						break;
 					default: break;
 					}
+					if (!S->PathStr.TrimStartAndEnd().IsEmpty())
+					{
+						VarName = CompileNestedPath(*S, S->Class);
+					}
 
 					if (!VarName.IsNone() && S->DataAssetInstance.IsValid())
 					{
 						if (UPinVarSubsystem* Subsystem = GEditor->GetEditorSubsystem<UPinVarSubsystem>())
 						{
-							Subsystem->StagePinVariableForDataAsset(
-								S->Class->GetFName(),
-								VarName,
-								GroupName,
-								S->DataAssetInstance.Get()
-							);
+							FPinVarPinTransaction Transaction(Subsystem, FText::FromString(TEXT("PinVar: Pin Variable")));
+							if (S->bAllAssetsOfClass)
+							{
+								Subsystem->StagePinVariableForAssetsOfClass(
+									S->Class->GetFName(), VarName, GroupName, S->Class);
+							}
+							else
+							{
+								Subsystem->StagePinVariableForDataAsset(
+									S->Class->GetFName(),
+									VarName,
+									GroupName,
+									S->DataAssetInstance.Get()
+								);
+							}
 							Subsystem->MergeStagedIntoPinned();
 							Subsystem->SaveToDisk();
 						}
@@ -1356,6 +2509,10 @@ void SPinVarPanel::ShowAddDialogForDataAsset(UObject* DataAssetInstance)
 						break;
 					default: break;
 					}
+					if (!S->PathStr.TrimStartAndEnd().IsEmpty())
+					{
+						VarName = CompileNestedPath(*S, S->Class);
+					}
 
 					if (VarName.IsNone() || !S->DataAssetInstance.IsValid())
 					{
@@ -1366,12 +2523,20 @@ void SPinVarPanel::ShowAddDialogForDataAsset(UObject* DataAssetInstance)
 
 					if (UPinVarSubsystem* Subsystem = GEditor->GetEditorSubsystem<UPinVarSubsystem>())
 					{
+						FPinVarPinTransaction Transaction(Subsystem, FText::FromString(TEXT("PinVar: Pin Variable")));
 						TArray<FString> Groups;
 						GroupCsv.ParseIntoArray(Groups, TEXT(","), true);
 						for (FString& G : Groups)
 						{
 							G = G.TrimStartAndEnd();
-							if (!G.IsEmpty())
+							if (G.IsEmpty()) continue;
+
+							if (S->bAllAssetsOfClass)
+							{
+								Subsystem->StagePinVariableForAssetsOfClass(
+									S->Class->GetFName(), VarName, FName(*G), S->Class);
+							}
+							else
 							{
 								Subsystem->StagePinVariableForDataAsset(
 									S->Class->GetFName(),
@@ -1379,8 +2544,8 @@ void SPinVarPanel::ShowAddDialogForDataAsset(UObject* DataAssetInstance)
 									FName(*G),
 									S->DataAssetInstance.Get()
 								);
-								GetAllGroups(S);
 							}
+							GetAllGroups(S);
 						}
 						Subsystem->MergeStagedIntoPinned();
 						Subsystem->SaveToDisk();
@@ -1434,7 +2599,6 @@ void SPinVarPanel::ShowAddDialog(UBlueprint* BP)
 	TArray<FName> TmpVar;
 	GatherLocalVars(BP, TmpVar);
 	for (const FName& N : TmpVar) S->LocalVarOpts.Add(MakeShared<FString>(N.ToString()));
-	if (S->LocalVarOpts.Num()) S->LocalVarSel = S->LocalVarOpts[0];
 
 
 	// Parent C++ properties
@@ -1442,10 +2606,9 @@ void SPinVarPanel::ShowAddDialog(UBlueprint* BP)
 	TArray<FName> TmpProp;
 	GatherNativeProps(TargetClass, TmpProp);
 	for (const FName& N : TmpProp) S->NativePropOpts.Add(MakeShared<FString>(N.ToString()));
-	if (S->NativePropOpts.Num()) S->NativePropSel = S->NativePropOpts[0];
 
 
-	BuildComponentOptions(BP, TargetClass, S->CompOpts);
+	BuildComponentOptions(TargetClass, S->CompOpts);
 	GetAllGroups(S);
 	if (S->ExistingGroupOpts.Num())
 	{
@@ -1466,14 +2629,13 @@ void SPinVarPanel::ShowAddDialog(UBlueprint* BP)
 			UActorComponent* Template =
 				S->CompSel->Template.IsValid()
 					? S->CompSel->Template.Get()
-					: Cast<UActorComponent>(FindComponentTemplate(S->Class, S->CompSel->TemplateName));
+					: Cast<UActorComponent>(UPinVarSubsystem::FindComponentTemplate(S->Class, S->CompSel->TemplateName));
 
 			if (Template)
 			{
 				TArray<FName> Props;
 				GatherComponentPropsByTemplate(Template, Props);
 				for (const FName& N : Props) S->CompPropOpts.Add(MakeShared<FString>(N.ToString()));
-				if (S->CompPropOpts.Num()) S->CompPropSel = S->CompPropOpts[0];
 			}
 			else
 			{
@@ -1485,39 +2647,31 @@ void SPinVarPanel::ShowAddDialog(UBlueprint* BP)
 
 	// --- Build dialog UI ---
 
+	S->LocalVarList = MakeShared<FChecklist>();
+	S->LocalVarList->Source = &S->LocalVarOpts;
+	S->LocalVarList->Checked = &S->CheckedLocalVars;
+	S->LocalVarList->ApplyFilter();
+
+	S->NativePropList = MakeShared<FChecklist>();
+	S->NativePropList->Source = &S->NativePropOpts;
+	S->NativePropList->Checked = &S->CheckedNativeProps;
+	S->NativePropList->ApplyFilter();
+
+	S->CompPropList = MakeShared<FChecklist>();
+	S->CompPropList->Source = &S->CompPropOpts;
+	S->CompPropList->Checked = S->CompSel.IsValid()
+		                           ? &S->CheckedCompProps.FindOrAdd(S->CompSel->TemplateName)
+		                           : nullptr;
+	S->CompPropList->ApplyFilter();
+
 	TSharedRef<SWindow> Dialog = SNew(SWindow)
-		.Title(FText::FromString(TEXT("Add Variable to Group")))
+		.Title(FText::FromString(TEXT("Add Variables to Group")))
 		.SupportsMaximize(false)
 		.SupportsMinimize(false)
-		.ClientSize(FVector2D(520, 380));
+		.ClientSize(FVector2D(560, 600));
 
 	AddVariableWindow = Dialog;
 
-	// Helper for searchable combos over FString arrays
-	auto MakeStringCombo = [](TArray<TSharedPtr<FString>>& Source, TSharedPtr<FString>& Sel,
-	                          TFunction<void(TSharedPtr<FString>)> OnSel)
-	{
-		return SNew(SSearchableComboBox)
-			.OptionsSource(&Source)
-			.OnGenerateWidget_Lambda([](TSharedPtr<FString> It)
-			{
-				return SNew(STextBlock).Text(FText::FromString(It.IsValid() ? *It : TEXT("None")));
-			})
-			.OnSelectionChanged_Lambda([&Sel, OnSel](TSharedPtr<FString> NewSel, ESelectInfo::Type)
-			{
-				Sel = NewSel;
-				if (OnSel) OnSel(NewSel);
-			})
-			.InitiallySelectedItem(Sel)
-			[
-				SNew(STextBlock)
-				.Text_Lambda([&Sel]()
-				{
-					return Sel.IsValid() ? FText::FromString(*Sel) : FText::FromString(TEXT("None"));
-				})
-			];
-	};
-
 	Dialog->SetContent(
 		SNew(SVerticalBox)
 
@@ -1532,7 +2686,7 @@ void SPinVarPanel::ShowAddDialog(UBlueprint* BP)
 			+ SSegmentedControl<int32>::Slot(2).Text(FText::FromString("Component"))
 		]
 		// Local BP
-		+ SVerticalBox::Slot().AutoHeight().Padding(12, 6, 12, 4)
+		+ SVerticalBox::Slot().FillHeight(1.f).Padding(12, 6, 12, 4)
 		[
 			SNew(SVerticalBox)
 			.Visibility_Lambda([S]()
@@ -1543,16 +2697,16 @@ void SPinVarPanel::ShowAddDialog(UBlueprint* BP)
 			})
 			+ SVerticalBox::Slot().AutoHeight()
 			[
-				SNew(STextBlock).Text(FText::FromString("Variable:"))
+				SNew(STextBlock).Text(FText::FromString("Variables:"))
 			]
-			+ SVerticalBox::Slot().AutoHeight().Padding(0, 2, 0, 0)
+			+ SVerticalBox::Slot().FillHeight(1.f).Padding(0, 2, 0, 0)
 			[
-				MakeStringCombo(S->LocalVarOpts, S->LocalVarSel, nullptr)
+				MakeChecklistWidget(S->LocalVarList.ToSharedRef())
 			]
 		]
 
 		// Parent C++
-		+ SVerticalBox::Slot().AutoHeight().Padding(12, 6, 12, 4)
+		+ SVerticalBox::Slot().FillHeight(1.f).Padding(12, 6, 12, 4)
 		[
 			SNew(SVerticalBox)
 			.Visibility_Lambda([S]()
@@ -1563,16 +2717,16 @@ void SPinVarPanel::ShowAddDialog(UBlueprint* BP)
 			})
 			+ SVerticalBox::Slot().AutoHeight()
 			[
-				SNew(STextBlock).Text(FText::FromString("Property:"))
+				SNew(STextBlock).Text(FText::FromString("Properties:"))
 			]
-			+ SVerticalBox::Slot().AutoHeight().Padding(0, 2, 0, 0)
+			+ SVerticalBox::Slot().FillHeight(1.f).Padding(0, 2, 0, 0)
 			[
-				MakeStringCombo(S->NativePropOpts, S->NativePropSel, nullptr)
+				MakeChecklistWidget(S->NativePropList.ToSharedRef())
 			]
 		]
 
 		// Component
-		+ SVerticalBox::Slot().AutoHeight().Padding(12, 6, 12, 4)
+		+ SVerticalBox::Slot().FillHeight(1.f).Padding(12, 6, 12, 4)
 		[
 			SNew(SVerticalBox)
 			.Visibility_Lambda([S]()
@@ -1598,30 +2752,28 @@ void SPinVarPanel::ShowAddDialog(UBlueprint* BP)
 				{
 					S->CompSel.Reset();
 					S->CompPropOpts.Reset();
-					S->CompPropSel.Reset();
-
-					if (!S->Class || !NewSel.IsValid())
-					{
-						if (S->CompPropCombo.IsValid()) S->CompPropCombo->RefreshOptions();
-						return;
-					}
+					S->CompPropList->Checked = nullptr;
 
 					// Resolve label -> option
-					if (TSharedPtr<FCompOption>* FoundPtr = S->LabelToCompOpt.Find(*NewSel))
+					TSharedPtr<FCompOption>* FoundPtr = (S->Class && NewSel.IsValid())
+						                                    ? S->LabelToCompOpt.Find(*NewSel)
+						                                    : nullptr;
+					if (FoundPtr)
 					{
 						S->CompSel = *FoundPtr;
+						// checks are kept per component so a batch can span several of them
+						S->CompPropList->Checked = &S->CheckedCompProps.FindOrAdd(S->CompSel->TemplateName);
 
 						UActorComponent* Tmpl =
 							S->CompSel->Template.IsValid()
 								? S->CompSel->Template.Get()
-								: Cast<UActorComponent>(FindComponentTemplate(S->Class, S->CompSel->TemplateName));
+								: Cast<UActorComponent>(UPinVarSubsystem::FindComponentTemplate(S->Class, S->CompSel->TemplateName));
 
 						if (Tmpl)
 						{
 							TArray<FName> P;
 							GatherComponentPropsByTemplate(Tmpl, P);
 							for (const FName& N : P) S->CompPropOpts.Add(MakeShared<FString>(N.ToString()));
-							if (S->CompPropOpts.Num()) S->CompPropSel = S->CompPropOpts[0];
 						}
 						else
 						{
@@ -1631,11 +2783,7 @@ void SPinVarPanel::ShowAddDialog(UBlueprint* BP)
 						}
 					}
 
-					if (S->CompPropCombo.IsValid())
-					{
-						S->CompPropCombo->RefreshOptions();
-						S->CompPropCombo->SetSelectedItem(S->CompPropSel);
-					}
+					S->CompPropList->ApplyFilter();
 				})
 				[
 					SNew(STextBlock)
@@ -1650,60 +2798,30 @@ void SPinVarPanel::ShowAddDialog(UBlueprint* BP)
 
 			+ SVerticalBox::Slot().AutoHeight().Padding(0, 4, 0, 0)
 			[
-				SNew(STextBlock).Text(FText::FromString("Property:"))
+				SNew(STextBlock).Text(FText::FromString("Properties:"))
 			]
-			+ SVerticalBox::Slot().AutoHeight().Padding(0, 2, 0, 0)
+			+ SVerticalBox::Slot().FillHeight(1.f).Padding(0, 2, 0, 0)
 			[
-				SAssignNew(S->CompPropCombo, SSearchableComboBox)
-				                                                 .OptionsSource(&S->CompPropOpts)
- // TArray<TSharedPtr<FString>>
-				                                                 .OnGenerateWidget_Lambda([](TSharedPtr<FString> It)
-				                                                 {
-					                                                 return SNew(STextBlock).Text(
-							                                                 FText::FromString(
-								                                                 It.IsValid() ? *It : TEXT("None")));
-				                                                 })
-				                                                 .OnSelectionChanged_Lambda(
-					                                                 [S](TSharedPtr<FString> NewSel,
-					                                                     ESelectInfo::Type Info)
-					                                                 {
-						                                                 // If Enter was pressed with no explicit row highlighted, pick first filtered option
-						                                                 if (!NewSel.IsValid() && S->CompPropOpts.Num()
-							                                                 > 0)
-						                                                 {
-							                                                 NewSel = S->CompPropOpts[0];
-							                                                 if (S->CompPropCombo.IsValid())
-							                                                 {
-								                                                 S->CompPropCombo->SetSelectedItem(
-									                                                 NewSel);
-							                                                 }
-						                                                 }
-
-						                                                 S->CompPropSel = NewSel;
-
-						                                                 // Close the dropdown when selection comes from keyboard (Enter/Navigation)
-						                                                 if (Info == ESelectInfo::OnKeyPress || Info ==
-							                                                 ESelectInfo::OnNavigation)
-						                                                 {
-							                                                 if (S->CompPropCombo.IsValid())
-							                                                 {
-								                                                 S->CompPropCombo->SetIsOpen(false);
-							                                                 }
-						                                                 }
-					                                                 })
-				                                                 .InitiallySelectedItem(S->CompPropSel)
-				[
-					SNew(STextBlock)
-					.Text_Lambda([S]()
-					{
-						return S->CompPropSel.IsValid()
-							       ? FText::FromString(*S->CompPropSel)
-							       : FText::FromString(TEXT("None"));
-					})
-				]
+				MakeChecklistWidget(S->CompPropList.ToSharedRef())
 			]
 		]
 
+		+ SVerticalBox::Slot().AutoHeight().Padding(12, 6, 12, 4)
+		[
+			MakeNestedPathField(S)
+		]
+
+		// Selection summary
+		+ SVerticalBox::Slot().AutoHeight().Padding(12, 4, 12, 0)
+		[
+			SNew(STextBlock)
+			.ColorAndOpacity(FLinearColor(0.7f, 0.7f, 0.7f))
+			.Text_Lambda([S]()
+			{
+				return FText::FromString(FString::Printf(TEXT("%d selected"), S->NumChecked()));
+			})
+		]
+
 		// Group
 		+ SVerticalBox::Slot().AutoHeight().Padding(12, 10, 12, 8)
 		[
@@ -1756,7 +2874,10 @@ void SPinVarPanel::ShowAddDialog(UBlueprint* BP)
 			.VAlign(VAlign_Center)
 			[
 				SNew(SButton)
-				.IsEnabled_Lambda([S]() { return S->ExistingGroupSel.IsValid() && !S->ExistingGroupSel->IsEmpty(); })
+				.IsEnabled_Lambda([S]()
+				{
+					return S->NumChecked() > 0 && S->ExistingGroupSel.IsValid() && !S->ExistingGroupSel->IsEmpty();
+				})
 				.ButtonStyle(FAppStyle::Get(), "PrimaryButton")
 				.Text(FText::FromString("Add to existing group"))
 				.OnClicked_Lambda([this, S]()
@@ -1764,61 +2885,8 @@ void SPinVarPanel::ShowAddDialog(UBlueprint* BP)
 					if (!GEditor || !S->Class || !S->ExistingGroupSel.IsValid() || S->ExistingGroupSel->IsEmpty())
 						return FReply::Handled();
 
-					const FName GroupName = FName(**S->ExistingGroupSel);
-					FName VarName = NAME_None;
-
-					// Common helper to stage non-component vars
-					auto StageSimple = [&](const FName& InVar)
-					{
-						if (UPinVarSubsystem* Subsystem = GEditor->GetEditorSubsystem<UPinVarSubsystem>())
-						{
-							Subsystem->StagePinVariable(S->Class->GetFName(), InVar, GroupName, NAME_None);
-							Subsystem->MergeStagedIntoPinned();
-						}
-					};
-
-					switch (S->SourceType)
-					{
-					case FState::ESourceType::LocalBPVar: // Blueprint local
-						if (S->LocalVarSel.IsValid()) VarName = FName(**S->LocalVarSel);
-						if (!VarName.IsNone()) StageSimple(VarName);
-						break;
-
-					case FState::ESourceType::LocalCppVar: // Parent C++
-						if (S->NativePropSel.IsValid()) VarName = FName(**S->NativePropSel);
-						if (!VarName.IsNone()) StageSimple(VarName);
-						break;
-
-					case FState::ESourceType::ComponentVar: // Component
-						if (S->CompSel.IsValid() && S->CompPropSel.IsValid())
-						{
-							UActorComponent* Tmpl =
-								S->CompSel->Template.IsValid()
-									? S->CompSel->Template.Get()
-									: Cast<UActorComponent>(FindComponentTemplate(S->Class, S->CompSel->TemplateName));
-
-							if (Tmpl)
-							{
-								const FName TemplateKey = Tmpl->GetFName();
-								const FName PrettyVar = S->CompSel->Label;
-								VarName = FName(**S->CompPropSel);
-
-								if (UPinVarSubsystem* Subsystem = GEditor->GetEditorSubsystem<UPinVarSubsystem>())
-								{
-									Subsystem->StagePinVariableWithTemplate(
-										S->Class->GetFName(), VarName, GroupName, TemplateKey, Tmpl, PrettyVar);
-									Subsystem->MergeStagedIntoPinned();
-								}
-							}
-						}
-						break;
-					}
-					if (UPinVarSubsystem* Subsystem = GEditor->GetEditorSubsystem<UPinVarSubsystem>())
-					{
-						Subsystem->SaveToDisk();
-					}
-					Refresh(); // keep dialog open
-					return FReply::Handled();
+					CommitCheckedPins(*S, {FName(**S->ExistingGroupSel)});
+					return FReply::Handled(); // keep dialog open
 				})
 			]
 
@@ -1829,6 +2897,7 @@ void SPinVarPanel::ShowAddDialog(UBlueprint* BP)
 			+ SHorizontalBox::Slot().AutoWidth().Padding(0, 0, 8, 0)
 			[
 				SNew(SButton)
+				.IsEnabled_Lambda([S]() { return S->NumChecked() > 0; })
 				.ButtonStyle(FAppStyle::Get(), "PrimaryButton")
 				.Text(FText::FromString("Add"))
 				.OnClicked_Lambda([this, S]()
@@ -1839,78 +2908,18 @@ void SPinVarPanel::ShowAddDialog(UBlueprint* BP)
 					FString GroupCsv = S->GroupStr.TrimStartAndEnd();
 					if (GroupCsv.IsEmpty()) { GroupCsv = TEXT("Default"); }
 
-					FName VarName = NAME_None;
-					FName CompName = NAME_None;
-
-					switch (S->SourceType)
-					{
-					case FState::ESourceType::LocalBPVar: if (S->LocalVarSel.IsValid())
-							VarName = FName(
-								**S->LocalVarSel);
-						break;
-					case FState::ESourceType::LocalCppVar: if (S->NativePropSel.IsValid())
-							VarName = FName(
-								**S->NativePropSel);
-						break;
-					case FState::ESourceType::ComponentVar:
-						{
-							if (S->CompSel.IsValid() && S->CompPropSel.IsValid())
-							{
-								UActorComponent* Tmpl =
-									S->CompSel->Template.IsValid()
-										? S->CompSel->Template.Get()
-										: Cast<UActorComponent>(
-											FindComponentTemplate(S->Class, S->CompSel->TemplateName));
-
-								const FName TemplateKey = Tmpl ? Tmpl->GetFName() : S->CompSel->TemplateName;
-								const FName PrettyVar = S->CompSel->Label;
-								VarName = FName(**S->CompPropSel);
-
-								if (UPinVarSubsystem* Subsystem = GEditor->GetEditorSubsystem<UPinVarSubsystem>())
-								{
-									TArray<FString> Groups;
-									GroupCsv.ParseIntoArray(Groups, TEXT(","), true);
-									for (FString& G : Groups)
-									{
-										G = G.TrimStartAndEnd();
-										if (G.IsEmpty()) continue;
-										Subsystem->StagePinVariableWithTemplate(
-											S->Class->GetFName(), VarName, FName(*G), TemplateKey, Tmpl, PrettyVar);
-										GetAllGroups(S);
-									}
-									Subsystem->MergeStagedIntoPinned();
-									Subsystem->SaveToDisk();
-								}
-								Refresh();
-								return FReply::Handled();
-							}
-						}
-						break;
-					}
+					TArray<FString> Tokens;
+					GroupCsv.ParseIntoArray(Tokens, TEXT(","), true);
 
-					if (VarName.IsNone())
+					TArray<FName> Groups;
+					for (FString& G : Tokens)
 					{
-						UE_LOG(LogTemp, Warning, TEXT("PinVar: Add aborted — no variable selected."));
-						return FReply::Handled();
+						G = G.TrimStartAndEnd();
+						if (!G.IsEmpty()) Groups.Add(FName(*G));
 					}
 
-					if (UPinVarSubsystem* Subsystem = GEditor->GetEditorSubsystem<UPinVarSubsystem>())
-					{
-						TArray<FString> Groups;
-						GroupCsv.ParseIntoArray(Groups, TEXT(","), true);
-						for (FString& G : Groups)
-						{
-							G = G.TrimStartAndEnd();
-							if (!G.IsEmpty())
-							{
-								Subsystem->StagePinVariable(S->Class->GetFName(), VarName, FName(*G), CompName);
-								GetAllGroups(S);
-							}
-						}
-						Subsystem->MergeStagedIntoPinned();
-						Subsystem->SaveToDisk();
-					}
-					Refresh();
+					CommitCheckedPins(*S, Groups);
+					GetAllGroups(S);
 					return FReply::Handled();
 				})
 			]
@@ -1950,6 +2959,236 @@ void SPinVarPanel::ShowAddDialog(UBlueprint* BP)
 	GroupStr = S->GroupStr;
 }
 
+void SPinVarPanel::FChecklist::ApplyFilter()
+{
+	Filtered.Reset();
+	if (Source)
+	{
+		for (const TSharedPtr<FString>& It : *Source)
+		{
+			if (It.IsValid() && (Filter.IsEmpty() || It->Contains(Filter)))
+			{
+				Filtered.Add(It);
+			}
+		}
+	}
+
+	if (TSharedPtr<SListView<TSharedPtr<FString>>> LV = ListView.Pin())
+	{
+		LV->RequestListRefresh();
+	}
+}
+
+TSharedRef<SWidget> SPinVarPanel::MakeChecklistWidget(TSharedRef<FChecklist> List)
+{
+	TSharedRef<SListView<TSharedPtr<FString>>> LV =
+		SNew(SListView<TSharedPtr<FString>>)
+		.ListItemsSource(&List->Filtered)
+		.SelectionMode(ESelectionMode::None)
+		.OnGenerateRow_Lambda([List](TSharedPtr<FString> Item, const TSharedRef<STableViewBase>& Owner)
+		{
+			return SNew(STableRow<TSharedPtr<FString>>, Owner)
+				[
+					SNew(SCheckBox)
+					.IsChecked_Lambda([List, Item]()
+					{
+						return List->Checked && List->Checked->Contains(*Item)
+							       ? ECheckBoxState::Checked
+							       : ECheckBoxState::Unchecked;
+					})
+					.OnCheckStateChanged_Lambda([List, Item](ECheckBoxState NewState)
+					{
+						if (!List->Checked) return;
+						if (NewState == ECheckBoxState::Checked) List->Checked->Add(*Item);
+						else List->Checked->Remove(*Item);
+					})
+					[
+						SNew(STextBlock).Text(FText::FromString(*Item))
+					]
+				];
+		});
+	List->ListView = LV;
+
+	return SNew(SVerticalBox)
+		+ SVerticalBox::Slot().AutoHeight()
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot().FillWidth(1.f)
+			[
+				SNew(SSearchBox)
+				.OnTextChanged_Lambda([List](const FText& T)
+				{
+					List->Filter = T.ToString();
+					List->ApplyFilter();
+				})
+			]
+			+ SHorizontalBox::Slot().AutoWidth().Padding(6, 0, 0, 0)
+			[
+				SNew(SButton)
+				.ButtonStyle(FAppStyle::Get(), "FlatButton")
+				.ToolTipText(FText::FromString(TEXT("Check every entry matching the filter")))
+				.IsEnabled_Lambda([List]() { return List->Checked && List->Filtered.Num() > 0; })
+				.OnClicked_Lambda([List]()
+				{
+					for (const TSharedPtr<FString>& It : List->Filtered) List->Checked->Add(*It);
+					return FReply::Handled();
+				})
+				[
+					SNew(STextBlock).Text(FText::FromString(TEXT("Pin all matching")))
+				]
+			]
+			+ SHorizontalBox::Slot().AutoWidth().Padding(2, 0, 0, 0)
+			[
+				SNew(SButton)
+				.ButtonStyle(FAppStyle::Get(), "FlatButton")
+				.ToolTipText(FText::FromString(TEXT("Uncheck every entry matching the filter")))
+				.IsEnabled_Lambda([List]() { return List->Checked && List->Checked->Num() > 0; })
+				.OnClicked_Lambda([List]()
+				{
+					for (const TSharedPtr<FString>& It : List->Filtered) List->Checked->Remove(*It);
+					return FReply::Handled();
+				})
+				[
+					SNew(STextBlock).Text(FText::FromString(TEXT("Clear")))
+				]
+			]
+		]
+		+ SVerticalBox::Slot().FillHeight(1.f).Padding(0, 4, 0, 0)
+		[
+			LV
+		];
+}
+
+void SPinVarPanel::CommitCheckedPins(FState& S, const TArray<FName>& Groups)
+{
+	if (!GEditor || !S.Class || Groups.Num() == 0) return;
+	UPinVarSubsystem* Subsystem = GEditor->GetEditorSubsystem<UPinVarSubsystem>();
+	if (!Subsystem) return;
+
+	// every selected entry carries all of the chosen groups
+	TArray<int32> GroupIds;
+	for (const FName Group : Groups) { Subsystem->GroupTable.AddPathList(Group.ToString(), GroupIds); }
+	TArray<FPinnedVariable> Selected;
+
+	TArray<FString> Vars = S.CheckedLocalVars.Array();
+	Vars.Sort();
+	TArray<FString> Native = S.CheckedNativeProps.Array();
+	Native.Sort();
+	Vars.Append(Native);
+	for (const FString& V : Vars)
+	{
+		Selected.Add(FPinnedVariable(FName(*V), GroupIds));
+	}
+
+	for (const TSharedPtr<FCompOption>& Opt : S.CompOpts)
+	{
+		const TSet<FString>* Props = S.CheckedCompProps.Find(Opt->TemplateName);
+		if (!Props || Props->Num() == 0) continue;
+
+		UActorComponent* Tmpl =
+			Opt->Template.IsValid()
+				? Opt->Template.Get()
+				: Cast<UActorComponent>(UPinVarSubsystem::FindComponentTemplate(S.Class, Opt->TemplateName));
+		const FName TemplateKey = Tmpl ? Tmpl->GetFName() : Opt->TemplateName;
+
+		TArray<FString> Sorted = Props->Array();
+		Sorted.Sort();
+		for (const FString& P : Sorted)
+		{
+			FPinnedVariable E(FName(*P), GroupIds, TemplateKey, Opt->Label);
+			Subsystem->GetPinState(S.Class->GetFName(), FPinKey(E)).ResolvedTemplate = Tmpl;
+			Selected.Add(MoveTemp(E));
+		}
+	}
+
+	// nested path: against the selected component when adding component properties, else the class itself
+	if (!S.PathStr.TrimStartAndEnd().IsEmpty())
+	{
+		UActorComponent* PathTmpl = nullptr;
+		if (S.SourceType == FState::ESourceType::ComponentVar && S.CompSel.IsValid())
+		{
+			PathTmpl = S.CompSel->Template.IsValid()
+				           ? S.CompSel->Template.Get()
+				           : Cast<UActorComponent>(
+					           UPinVarSubsystem::FindComponentTemplate(S.Class, S.CompSel->TemplateName));
+			if (!PathTmpl)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("PinVar: Add aborted — template for '%s' not found."),
+				       *S.CompSel->Label.ToString());
+				return;
+			}
+		}
+
+		const FName PathName = CompileNestedPath(S, PathTmpl ? PathTmpl->GetClass() : S.Class);
+		if (PathName.IsNone()) return;
+
+		if (PathTmpl)
+		{
+			FPinnedVariable E(PathName, GroupIds, PathTmpl->GetFName(), S.CompSel->Label);
+			Subsystem->GetPinState(S.Class->GetFName(), FPinKey(E)).ResolvedTemplate = PathTmpl;
+			Selected.Add(MoveTemp(E));
+		}
+		else
+		{
+			Selected.Add(FPinnedVariable(PathName, GroupIds));
+		}
+	}
+
+	if (Selected.Num() == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("PinVar: Add aborted — no variable selected."));
+		return;
+	}
+
+	// one stage, merge, save, undo record and rebuild for the whole selection
+	int32 Added = 0;
+	{
+		FPinVarPinTransaction Transaction(Subsystem, FText::FromString(TEXT("PinVar: Pin Variables")));
+		Added = Subsystem->StagePinBatch(S.Class->GetFName(), Selected);
+		Subsystem->MergeStagedIntoPinned();
+		Subsystem->SaveToDisk();
+	}
+	UE_LOG(LogTemp, Display, TEXT("PinVar: pinned %d new entries (%d requested)."), Added, Selected.Num());
+
+	Refresh();
+}
+
+FName SPinVarPanel::CompileNestedPath(const FState& S, const UStruct* Owner)
+{
+	const FString PathStr = S.PathStr.TrimStartAndEnd().Replace(TEXT(" "), TEXT(""));
+	if (PathStr.IsEmpty()) return NAME_None;
+
+	const TSharedPtr<const FPinVarPropertyPath> Path = UPinVarSubsystem::FindPropertyPath(Owner, FName(*PathStr));
+	if (!Path.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("PinVar: '%s' is not a valid property path on %s."),
+		       *PathStr, Owner ? *Owner->GetName() : TEXT("None"));
+		return NAME_None;
+	}
+	if (!IsEditableProperty(Path->GetRootProperty()))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("PinVar: '%s' is not editable on %s."), *PathStr, *Owner->GetName());
+		return NAME_None;
+	}
+	return FName(*PathStr);
+}
+
+TSharedRef<SWidget> SPinVarPanel::MakeNestedPathField(TSharedRef<FState> S)
+{
+	return SNew(SVerticalBox)
+		+ SVerticalBox::Slot().AutoHeight()
+		[
+			SNew(STextBlock).Text(FText::FromString("Nested member path (optional, e.g. Movement.MaxSpeed):"))
+		]
+		+ SVerticalBox::Slot().AutoHeight().Padding(0, 2, 0, 0)
+		[
+			SNew(SEditableTextBox)
+			.HintText(FText::FromString(TEXT("Struct.Member, Array[0].Member, Component.Property")))
+			.Text_Lambda([S]() { return FText::FromString(S->PathStr); })
+			.OnTextChanged_Lambda([S](const FText& T) { S->PathStr = T.ToString(); })
+		];
+}
+
 void SPinVarPanel::GatherLocalVars(UBlueprint* BP, TArray<FName>& OutVars) const
 {
 	OutVars.Reset();
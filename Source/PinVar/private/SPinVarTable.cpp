@@ -0,0 +1,577 @@
+﻿// SPinVarTable.cpp
+#include "SPinVarTable.h"
+
+#include "ISinglePropertyView.h"
+#include "PropertyEditorModule.h"
+#include "Modules/ModuleManager.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Layout/SScrollBox.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Input/SSearchBox.h"
+#include "Widgets/Input/SEditableTextBox.h"
+#include "SSearchableComboBox.h"
+#include "Widgets/Views/SHeaderRow.h"
+#include "Widgets/Views/STableRow.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Editor.h"
+
+#include "PinVarSubsystem.h"
+#include "SPinVarPanel.h"
+#include "PinVarStats.h"
+
+const FName SPinVarTable::TargetColumnId("PinVar.Target");
+
+// Cell showing one pinned value as text; swaps in an ISinglePropertyView while being edited
+class SPinVarTableCell : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SPinVarTableCell)
+		{
+		}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, const TSharedRef<FPinVarTableRow>& InRow, FName InVar,
+	               const TSharedRef<SPinVarTable>& InOwner)
+	{
+		Row = InRow;
+		Var = InVar;
+		RootName = FPinVarPropertyPath::GetRootName(InVar);
+		Owner = InOwner;
+
+		ChildSlot
+		[
+			SAssignNew(Content, SBox)
+			.MinDesiredHeight(22.f)
+			.VAlign(VAlign_Center)
+		];
+		ShowText();
+	}
+
+	void BeginEdit()
+	{
+		UObject* Target = Row->Target.Get();
+		if (!Target && !bEditing && !Row->AssetPath.IsNull())
+		{
+			// preview-only row: load the asset now and open the editor when it arrives
+			if (TSharedPtr<SPinVarTable> Table = Owner.Pin())
+			{
+				Row->OnLoaded = FSimpleDelegate::CreateSP(this, &SPinVarTableCell::BeginEdit);
+				Table->RequestRowLoad(Row.ToSharedRef());
+			}
+			return;
+		}
+		if (!Target || bEditing) return;
+
+		TRACE_CPUPROFILER_EVENT_SCOPE(PinVar_CreatePropertyWidget);
+		INC_DWORD_STAT(STAT_PinVar_WidgetsCreated);
+
+		TSharedPtr<SWidget> View;
+		if (FPinVarPropertyPath::IsNested(Var))
+		{
+			// nested members have no single-property view; edit their exported text instead
+			const TSharedPtr<const FPinVarPropertyPath> Path = UPinVarSubsystem::FindPropertyPath(Target->GetClass(), Var);
+			if (!Path.IsValid()) return;
+
+			FString ValueStr;
+			Path->ExportValue(Target, ValueStr);
+			View = SNew(SEditableTextBox)
+				.Text(FText::FromString(ValueStr))
+				.SelectAllTextWhenFocused(true)
+				.OnTextCommitted_Lambda([this](const FText& NewText, ETextCommit::Type CommitType)
+				{
+					if (CommitType == ETextCommit::OnCleared) return;
+					UPinVarSubsystem* Subsystem = GEditor ? GEditor->GetEditorSubsystem<UPinVarSubsystem>() : nullptr;
+					if (Subsystem && Row->Target.IsValid())
+					{
+						Subsystem->ApplyValueBatch({FPinVarValueWrite{Row->Target, Var, NewText.ToString()}},
+						                           FText::FromString(TEXT("PinVar: Edit Value")));
+					}
+					EndEdit();
+				});
+		}
+		else
+		{
+			FPropertyEditorModule& PropEd = FModuleManager::LoadModuleChecked<FPropertyEditorModule>("PropertyEditor");
+			FSinglePropertyParams Params;
+			Params.NamePlacement = EPropertyNamePlacement::Hidden;
+			View = PropEd.CreateSingleProperty(Target, Var, Params);
+		}
+		if (!View.IsValid()) return;
+
+		if (TSharedPtr<SPinVarTable> Table = Owner.Pin())
+		{
+			Table->SetEditingCell(SharedThis(this));
+		}
+
+		bEditing = true;
+		Content->SetContent(
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot().FillWidth(1.f)
+			[
+				View.ToSharedRef()
+			]
+			+ SHorizontalBox::Slot().AutoWidth().Padding(4, 0, 0, 0)
+			[
+				SNew(SButton)
+				.ButtonStyle(FAppStyle::Get(), "FlatButton")
+				.ContentPadding(FMargin(4, 0))
+				.ToolTipText(FText::FromString(TEXT("Done editing")))
+				.OnClicked_Lambda([this]()
+				{
+					EndEdit();
+					return FReply::Handled();
+				})
+				[
+					SNew(STextBlock).Text(FText::FromString(TEXT("OK")))
+				]
+			]);
+	}
+
+	void EndEdit()
+	{
+		if (!bEditing) return;
+		bEditing = false;
+		CachedFor.Reset(); // value may have changed
+		ShowText();
+	}
+
+	virtual FReply OnMouseButtonDoubleClick(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override
+	{
+		BeginEdit();
+		return FReply::Handled();
+	}
+
+private:
+	void ShowText()
+	{
+		Content->SetContent(
+			SNew(STextBlock)
+			.Text(this, &SPinVarTableCell::GetValueText)
+			.ToolTipText(FText::FromString(TEXT("Double-click to edit")))
+		);
+	}
+
+	FText GetValueText() const
+	{
+		UObject* Target = Row->Target.Get();
+		if (!Target)
+		{
+			if (const FString* Preview = Row->Previews.Find(Var)) return FText::FromString(*Preview);
+			return FText::FromString(Row->AssetPath.IsNull() ? TEXT("—") : TEXT("loading…"));
+		}
+
+		// export once per target; re-exported only when this (target, property) changes or the target does
+		const TSharedPtr<SPinVarTable> Table = Owner.Pin();
+		const uint32 Serial = Table.IsValid() ? Table->GetValueSerial(Target, RootName) : 0;
+		if (CachedFor.Get() != Target || CachedSerial != Serial)
+		{
+			CachedFor = Target;
+			CachedSerial = Serial;
+			FString ValueStr;
+			if (const TSharedPtr<const FPinVarPropertyPath> Path =
+				UPinVarSubsystem::FindPropertyPath(Target->GetClass(), Var))
+			{
+				Path->ExportValue(Target, ValueStr);
+			}
+			CachedText = FText::FromString(ValueStr);
+		}
+		return CachedText;
+	}
+
+	TSharedPtr<FPinVarTableRow> Row;
+	FName Var;
+	FName RootName;
+	TWeakPtr<SPinVarTable> Owner;
+	TSharedPtr<SBox> Content;
+	bool bEditing = false;
+
+	mutable TWeakObjectPtr<UObject> CachedFor;
+	mutable uint32 CachedSerial = 0;
+	mutable FText CachedText;
+};
+
+class SPinVarTableRowWidget : public SMultiColumnTableRow<TSharedPtr<FPinVarTableRow>>
+{
+public:
+	SLATE_BEGIN_ARGS(SPinVarTableRowWidget)
+		{
+		}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& OwnerTable,
+	               const TSharedRef<FPinVarTableRow>& InRow, const TSharedRef<SPinVarTable>& InOwner)
+	{
+		Row = InRow;
+		Owner = InOwner;
+		FSuperRowType::Construct(FSuperRowType::FArguments(), OwnerTable);
+	}
+
+	virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override
+	{
+		if (ColumnName == SPinVarTable::TargetColumnId)
+		{
+			return SNew(SVerticalBox)
+				+ SVerticalBox::Slot().AutoHeight()
+				[
+					SNew(STextBlock).Text(Row->Label)
+				]
+				+ SVerticalBox::Slot().AutoHeight()
+				[
+					SNew(STextBlock)
+					.Text(Row->SubLabel)
+					.Font(FCoreStyle::GetDefaultFontStyle("Regular", 8))
+					.ColorAndOpacity(FLinearColor(0.7f, 0.7f, 0.7f))
+				];
+		}
+
+		TSharedPtr<SPinVarTable> Table = Owner.Pin();
+		if (!Table || !Row->PinnedVars.Contains(ColumnName))
+		{
+			return SNullWidget::NullWidget;
+		}
+		return SNew(SPinVarTableCell, Row.ToSharedRef(), ColumnName, Table.ToSharedRef());
+	}
+
+	const TSharedPtr<FPinVarTableRow>& GetRow() const { return Row; }
+
+private:
+	TSharedPtr<FPinVarTableRow> Row;
+	TWeakPtr<SPinVarTable> Owner;
+};
+
+void SPinVarTable::Construct(const FArguments& InArgs)
+{
+	SubsystemWeak = GEditor ? GEditor->GetEditorSubsystem<UPinVarSubsystem>() : nullptr;
+	SAssignNew(HeaderRow, SHeaderRow);
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+
+		+ SVerticalBox::Slot().AutoHeight().Padding(4.f)
+		[
+			SNew(SSearchBox)
+			.HintText(FText::FromString(TEXT("Filter targets")))
+			.OnTextChanged_Lambda([this](const FText& T)
+			{
+				FilterText = T.ToString();
+				ApplyFilter();
+			})
+		]
+
+		// Batch edit: one property, one value, every selected row
+		+ SVerticalBox::Slot().AutoHeight().Padding(4.f, 0.f, 4.f, 4.f)
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Center)
+			[
+				SAssignNew(BatchColumnCombo, SSearchableComboBox)
+				.OptionsSource(&ColumnOptions)
+				.OnGenerateWidget_Lambda([](TSharedPtr<FString> It)
+				{
+					return SNew(STextBlock).Text(FText::FromString(It.IsValid() ? *It : TEXT("None")));
+				})
+				.OnSelectionChanged_Lambda([this](TSharedPtr<FString> NewSel, ESelectInfo::Type)
+				{
+					BatchColumn = NewSel;
+					PrefillBatchValue();
+				})
+				[
+					SNew(STextBlock)
+					.Text_Lambda([this]()
+					{
+						return BatchColumn.IsValid()
+							       ? FText::FromString(*BatchColumn)
+							       : FText::FromString(TEXT("Select property…"));
+					})
+				]
+			]
+			+ SHorizontalBox::Slot().FillWidth(1.f).Padding(6, 0).VAlign(VAlign_Center)
+			[
+				SNew(SEditableTextBox)
+				.HintText(FText::FromString(TEXT("Value (as shown in the cells)")))
+				.Text_Lambda([this]() { return FText::FromString(BatchValue); })
+				.OnTextChanged_Lambda([this](const FText& T) { BatchValue = T.ToString(); })
+			]
+			+ SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Center)
+			[
+				SNew(SButton)
+				.ButtonStyle(FAppStyle::Get(), "PrimaryButton")
+				.IsEnabled_Lambda([this]()
+				{
+					return BatchColumn.IsValid() && ListView.IsValid() && ListView->GetNumItemsSelected() > 0;
+				})
+				.Text(FText::FromString(TEXT("Set on selected")))
+				.OnClicked(this, &SPinVarTable::OnSetOnSelected)
+			]
+		]
+
+		+ SVerticalBox::Slot().FillHeight(1.f)
+		[
+			SNew(SScrollBox)
+			.Orientation(Orient_Horizontal)
+			+ SScrollBox::Slot()
+			[
+				SAssignNew(ListView, SListView<TSharedPtr<FPinVarTableRow>>)
+				.ListItemsSource(&FilteredRows)
+				.SelectionMode(ESelectionMode::Multi)
+				.HeaderRow(HeaderRow)
+				.OnGenerateRow(this, &SPinVarTable::OnGenerateRow)
+				.OnRowReleased(this, &SPinVarTable::OnRowReleased)
+			]
+		]
+	];
+}
+
+void SPinVarTable::Refresh()
+{
+	SCOPE_CYCLE_COUNTER(STAT_PinVar_TableRefresh);
+
+	AllRows.Reset();
+	Columns.Reset();
+
+	UPinVarSubsystem* Subsystem = GEditor ? GEditor->GetEditorSubsystem<UPinVarSubsystem>() : nullptr;
+	if (Subsystem)
+	{
+		// (class, component, asset) -> row
+		TMap<TTuple<FName, FName, FSoftObjectPath>, TSharedPtr<FPinVarTableRow>> RowsByTarget;
+		TSet<FName> ColumnSet;
+
+		for (const TPair<FName, TArray<FPinnedVariable>>& Pair : Subsystem->GetPinnedGroups())
+		{
+			UClass* Cls = FindFirstObjectSafe<UClass>(*Pair.Key.ToString());
+			UObject* CDO = Cls ? Cls->GetDefaultObject(true) : nullptr;
+			const FString ClassLabel = Cls ? SPinVarPanel::PrettyBlueprintDisplayName(Cls) : Pair.Key.ToString();
+
+			for (const FPinnedVariable& Pinned : Pair.Value)
+			{
+				if (IsBrokenPin(Subsystem->GetResolveState(Pair.Key, Pinned))) continue; // listed in the group view's broken section
+
+				TSharedPtr<FPinVarTableRow>& Row = RowsByTarget.FindOrAdd(
+					MakeTuple(Pair.Key, Pinned.ComponentTemplateName, Pinned.AssetPath));
+				if (!Row)
+				{
+					Row = MakeShared<FPinVarTableRow>();
+					Row->ClassName = Pair.Key;
+					Row->ComponentTemplateName = Pinned.ComponentTemplateName;
+					Row->AssetPath = Pinned.AssetPath;
+
+					if (!Pinned.AssetPath.IsNull())
+					{
+						// no load here; visible rows request it in OnGenerateRow
+						Row->Target = Pinned.AssetPath.ResolveObject();
+						Row->Label = FText::FromString(Pinned.AssetPath.GetAssetName());
+						Row->SubLabel = FText::FromString(ClassLabel);
+					}
+					else if (!Pinned.ComponentTemplateName.IsNone())
+					{
+						UObject* Tmpl = Subsystem->GetResolvedTemplate(Pair.Key, Pinned);
+						if (!Tmpl) { Tmpl = UPinVarSubsystem::FindComponentTemplate(Cls, Pinned.ComponentTemplateName); }
+						Row->Target = Tmpl;
+						const FName CompLabel = !Pinned.ComponentVariablePrettyName.IsNone()
+							                        ? Pinned.ComponentVariablePrettyName
+							                        : Pinned.ComponentTemplateName;
+						Row->Label = FText::FromString(ClassLabel);
+						Row->SubLabel = FText::FromString(FString::Printf(TEXT("Component: %s"), *CompLabel.ToString()));
+					}
+					else
+					{
+						Row->Target = CDO;
+						Row->Label = FText::FromString(ClassLabel);
+						Row->SubLabel = FText::FromString(TEXT("Class defaults"));
+					}
+					AllRows.Add(Row);
+				}
+
+				Row->PinnedVars.Add(Pinned.VariableName);
+				ColumnSet.Add(Pinned.VariableName);
+
+				FString Preview;
+				if (!Row->Target.IsValid() && !Row->AssetPath.IsNull() &&
+					UPinVarSubsystem::GetUnloadedValuePreview(Row->AssetPath, Pinned.VariableName, Preview))
+				{
+					Row->Previews.Add(Pinned.VariableName, MoveTemp(Preview));
+				}
+			}
+		}
+
+		Columns = ColumnSet.Array();
+		Columns.Sort(FNameLexicalLess());
+	}
+
+	AllRows.Sort([](const TSharedPtr<FPinVarTableRow>& A, const TSharedPtr<FPinVarTableRow>& B)
+	{
+		const int32 Cmp = A->Label.CompareToCaseIgnored(B->Label);
+		return Cmp != 0 ? Cmp < 0 : A->SubLabel.CompareToCaseIgnored(B->SubLabel) < 0;
+	});
+
+	RebuildColumns();
+	ApplyFilter();
+
+	// batch edit options follow the columns
+	const FString PreviousColumn = BatchColumn.IsValid() ? *BatchColumn : FString();
+	ColumnOptions.Reset();
+	BatchColumn.Reset();
+	for (const FName& Col : Columns)
+	{
+		TSharedPtr<FString> Opt = MakeShared<FString>(Col.ToString());
+		if (*Opt == PreviousColumn) { BatchColumn = Opt; }
+		ColumnOptions.Add(Opt);
+	}
+	if (BatchColumnCombo.IsValid())
+	{
+		BatchColumnCombo->RefreshOptions();
+	}
+}
+
+void SPinVarTable::PrefillBatchValue()
+{
+	if (!BatchColumn.IsValid() || !ListView.IsValid()) return;
+
+	const FName Var(**BatchColumn);
+	for (const TSharedPtr<FPinVarTableRow>& Row : ListView->GetSelectedItems())
+	{
+		UObject* Target = Row->Target.Get();
+		if (!Target || !Row->PinnedVars.Contains(Var)) continue;
+
+		if (const TSharedPtr<const FPinVarPropertyPath> Path =
+			UPinVarSubsystem::FindPropertyPath(Target->GetClass(), Var))
+		{
+			BatchValue.Reset();
+			Path->ExportValue(Target, BatchValue);
+			return;
+		}
+	}
+}
+
+FReply SPinVarTable::OnSetOnSelected()
+{
+	UPinVarSubsystem* Subsystem = GEditor ? GEditor->GetEditorSubsystem<UPinVarSubsystem>() : nullptr;
+	if (!Subsystem || !BatchColumn.IsValid() || !ListView.IsValid()) return FReply::Handled();
+
+	if (TSharedPtr<SPinVarTableCell> Cell = EditingCell.Pin())
+	{
+		Cell->EndEdit();
+	}
+
+	const FName Var(**BatchColumn);
+	TArray<FPinVarValueWrite> Writes;
+	int32 Skipped = 0;
+	for (const TSharedPtr<FPinVarTableRow>& Row : ListView->GetSelectedItems())
+	{
+		if (!Row->PinnedVars.Contains(Var)) continue;
+		if (!Row->Target.IsValid())
+		{
+			++Skipped; // still loading
+			continue;
+		}
+		Writes.Add({Row->Target, Var, BatchValue});
+	}
+
+	Subsystem->ApplyValueBatch(
+		Writes, FText::FromString(FString::Printf(TEXT("PinVar: Set %s on %d targets"), *Var.ToString(), Writes.Num())));
+	if (Skipped > 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("PinVar: %d selected rows skipped because their assets are not loaded yet."),
+		       Skipped);
+	}
+	return FReply::Handled();
+}
+
+uint32 SPinVarTable::GetValueSerial(const UObject* Target, FName RootProperty) const
+{
+	UPinVarSubsystem* Subsystem = SubsystemWeak.Get();
+	return Subsystem ? Subsystem->GetValueSerial(Target, RootProperty) : 0;
+}
+
+void SPinVarTable::RebuildColumns()
+{
+	HeaderRow->ClearColumns();
+	HeaderRow->AddColumn(
+		SHeaderRow::Column(TargetColumnId)
+		.DefaultLabel(FText::FromString(TEXT("Target")))
+		.ManualWidth(240.f));
+
+	for (const FName& Col : Columns)
+	{
+		HeaderRow->AddColumn(
+			SHeaderRow::Column(Col)
+			.DefaultLabel(FText::FromName(Col))
+			.ManualWidth(160.f));
+	}
+}
+
+void SPinVarTable::ApplyFilter()
+{
+	FilteredRows.Reset();
+	for (const TSharedPtr<FPinVarTableRow>& Row : AllRows)
+	{
+		if (FilterText.IsEmpty()
+			|| Row->Label.ToString().Contains(FilterText)
+			|| Row->SubLabel.ToString().Contains(FilterText))
+		{
+			FilteredRows.Add(Row);
+		}
+	}
+
+	if (ListView.IsValid())
+	{
+		ListView->RequestListRefresh();
+	}
+}
+
+TSharedRef<ITableRow> SPinVarTable::OnGenerateRow(TSharedPtr<FPinVarTableRow> Row,
+                                                  const TSharedRef<STableViewBase>& Owner)
+{
+	// rows are generated only while on screen, so this is where data assets get loaded (or re-held if still
+	// resident); a row whose every column has a registry preview waits until one of its cells is edited
+	if (!Row->AssetPath.IsNull() && (Row->Target.IsValid() || Row->Previews.Num() < Row->PinnedVars.Num()))
+	{
+		RequestRowLoad(Row.ToSharedRef());
+	}
+
+	return SNew(SPinVarTableRowWidget, Owner, Row.ToSharedRef(), SharedThis(this));
+}
+
+void SPinVarTable::OnRowReleased(const TSharedRef<ITableRow>& RowWidget)
+{
+	// scrolled out of view: stop holding the asset so GC can reclaim it; it reloads if the row comes back
+	const TSharedPtr<FPinVarTableRow>& Row = StaticCastSharedRef<SPinVarTableRowWidget>(RowWidget)->GetRow();
+	if (Row.IsValid() && !Row->AssetPath.IsNull())
+	{
+		Row->OnLoaded.Unbind();
+		UPinVarSubsystem::ReleaseLoadHandle(Row->LoadHandle);
+	}
+}
+
+void SPinVarTable::RequestRowLoad(const TSharedRef<FPinVarTableRow>& Row)
+{
+	if (Row->LoadHandle.IsValid()) return;
+
+	INC_DWORD_STAT(STAT_PinVar_AssetsRequested);
+	TWeakPtr<FPinVarTableRow> WeakRow = Row;
+	Row->LoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		Row->AssetPath,
+		FStreamableDelegate::CreateLambda([WeakRow]()
+		{
+			if (TSharedPtr<FPinVarTableRow> R = WeakRow.Pin())
+			{
+				R->Target = R->AssetPath.ResolveObject();
+				INC_DWORD_STAT(STAT_PinVar_AssetsLoaded);
+				R->OnLoaded.ExecuteIfBound();
+				R->OnLoaded.Unbind();
+			}
+		}));
+}
+
+void SPinVarTable::SetEditingCell(const TSharedPtr<SPinVarTableCell>& Cell)
+{
+	TSharedPtr<SPinVarTableCell> Previous = EditingCell.Pin();
+	if (Previous.IsValid() && Previous != Cell)
+	{
+		Previous->EndEdit();
+	}
+	EditingCell = Cell;
+}
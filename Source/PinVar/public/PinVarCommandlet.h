@@ -0,0 +1,40 @@
+// PinVarCommandlet.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "PinVarCommandlet.generated.h"
+
+class UPinVarSubsystem;
+
+/**
+ * Headless pin management: UnrealEditor-Cmd <Project> -run=PinVar -Mode=<Mode> [options]
+ *
+ *   Validate  resolve every pin (class, component template, property, asset); exit code 1 if any are broken
+ *   Prune     Validate, then remove broken pins and save
+ *   Export    -Out=<file>                write the current pins to another file
+ *   Import    -In=<file> [-Replace]      merge (or replace) pins from another file and save
+ *   ExportValues [-Out=<csv>]           write every pinned value to CSV (default <Project>/PinVar/Values.csv)
+ *   ImportValues [-In=<csv>]            apply the values that differ from a CSV and save the touched packages
+ *
+ * Common: -File=<pins json> to work on a file other than <Project>/PinVar/Pinned.json,
+ *         -Report=<csv> to write one line per checked pin (Validate / Prune).
+ */
+UCLASS()
+class UPinVarCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UPinVarCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	int32 RunValidate(UPinVarSubsystem& Subsystem, const TMap<FString, FString>& ParamsMap, bool bPrune);
+	int32 RunExport(UPinVarSubsystem& Subsystem, const TMap<FString, FString>& ParamsMap);
+	int32 RunImport(UPinVarSubsystem& Subsystem, const TMap<FString, FString>& ParamsMap,
+	                const TArray<FString>& Switches);
+	int32 RunExportValues(UPinVarSubsystem& Subsystem, const TMap<FString, FString>& ParamsMap);
+	int32 RunImportValues(UPinVarSubsystem& Subsystem, const TMap<FString, FString>& ParamsMap);
+};
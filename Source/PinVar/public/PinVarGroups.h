@@ -0,0 +1,60 @@
+// PinVarGroups.h
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FJsonObject;
+
+// One group record. Pins reference groups by id, so renaming or moving a group touches only its record.
+struct FPinVarGroup
+{
+	FName Name;             // this segment only ("Melee" in "Combat|Melee")
+	int32 ParentId = 0;     // 0 = top level
+	int32 MergedInto = 0;   // non-zero: merged away; kept so pins that still hold this id follow the merge
+	TArray<int32> Children; // live child records only
+};
+
+// Group tree shared by every pin. Ids start at 1; 0 means "no group".
+class PINVAR_API FPinVarGroupTable
+{
+public:
+	// "Combat|Melee" -> id of Melee, creating missing records; segments are trimmed. 0 for an empty path.
+	int32 FindOrAddPath(const FString& Path);
+	int32 FindPath(const FString& Path) const;
+	// comma-separated list ("Combat|Melee, Tuning"); adds ids not already in InOutIds, returns how many
+	int32 AddPathList(const FString& List, TArray<int32>& InOutIds);
+
+	// follows merges; 0 for unknown ids
+	int32 Resolve(int32 Id) const;
+	const FPinVarGroup* Find(int32 Id) const;
+	FName GetName(int32 Id) const;
+	FString GetPath(int32 Id) const;
+	FString GetPathList(const TArray<int32>& Ids) const;
+	// resolved ids from the top-level group down to Id
+	void GetAncestry(int32 Id, TArray<int32>& OutChain) const;
+	void GetAllPaths(TArray<FString>& OutPaths) const;
+	bool IsAncestorOf(int32 AncestorId, int32 Id) const;
+
+	// Each edits only the records involved; pins keep their ids. Renaming or moving onto an existing
+	// sibling of the same name merges into it. Merge folds same-named children together.
+	bool Rename(int32 Id, FName NewName);
+	bool Move(int32 Id, int32 NewParentId);
+	bool Merge(int32 FromId, int32 IntoId);
+
+	// drops records that no pin uses, directly or as an ancestor / merge target
+	void RemoveUnused(const TSet<int32>& UsedIds);
+	void Reset();
+	int32 Num() const { return Records.Num(); }
+
+	void Write(FJsonObject& Out) const;
+	void Read(const FJsonObject& In);
+
+private:
+	int32 FindChild(int32 ParentId, FName Name) const;
+	void Attach(int32 Id, int32 ParentId);
+	void Detach(int32 Id);
+
+	TMap<int32, FPinVarGroup> Records;
+	TMap<TPair<int32, FName>, int32> ChildIndex; // (parent, name) -> live child
+	int32 NextId = 1;
+};
@@ -2,8 +2,10 @@
 
 #include "SPinVarPanel.h"
 #include "Modules/ModuleManager.h"
+#include "Containers/Ticker.h"
 
 class SDockTab;
+struct FAssetData;
 class SPinVarPanel;
 
 class FPinVarModule : public IModuleInterface
@@ -19,11 +21,26 @@ private:
 	void UnregisterMenus();
 	void ScanPinnedVariables();
 
-	bool InitialRefreshOnce(float);
+	// initial refresh follows asset discovery instead of a fixed delay
+	void OnAssetDiscovered(const FAssetData& AssetData);
+	void OnAssetDiscoveryFinished();
+	void ScheduleDiscoveryRefresh();
+	bool RefreshForDiscovery(float);
+	void UnbindAssetRegistry();
 
 private:
 	FDelegateHandle MenuRegHandle;
 	static const FName PinVarTabName;
 
 	TWeakPtr<SPinVarPanel> PanelWeak;
+
+	FDelegateHandle AssetAddedHandle;
+	FDelegateHandle FilesLoadedHandle;
+	FTSTicker::FDelegateHandle DiscoveryRefreshHandle;
+	// pinned Blueprint / data asset name -> classes whose pins it resolves; rebuilt when the pins revision moves
+	TMap<FName, TArray<FName>> WantedAssetClasses;
+	uint32 WantedAssetsRevision = 0;
+	bool bWantedAssetNamesBuilt = false;
+	TSet<FName> DiscoveredClasses; // matched since the last refresh
+	bool bFullDiscoveryRefresh = false;
 };
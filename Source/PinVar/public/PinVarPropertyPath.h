@@ -0,0 +1,42 @@
+// PinVarPropertyPath.h
+#pragma once
+
+#include "CoreMinimal.h"
+
+// A pinned property path such as "MaxHealth", "Movement.MaxSpeed" or "Abilities[3].Cooldown",
+// compiled once against a class/struct into resolved FProperty segments. Segments step into
+// structs, array elements (dynamic or C-style) and referenced sub-objects.
+struct PINVAR_API FPinVarPropertyPath
+{
+	struct FSegment
+	{
+		FProperty* Property = nullptr;
+		int32 ArrayIndex = INDEX_NONE;
+	};
+
+	TArray<FSegment> Segments;
+	TWeakObjectPtr<const UStruct> Owner; // struct the path was compiled against
+
+	// true for anything but a plain top-level property name
+	static bool IsNested(FName VariableName);
+	// top-level property name of a path ("Movement" for "Movement.MaxSpeed")
+	static FName GetRootName(FName VariableName);
+
+	// parses and resolves every segment against Owner; false if any segment does not exist
+	bool Compile(const UStruct* Owner, const FString& PathString);
+
+	bool IsValid() const { return Segments.Num() > 0; }
+	bool IsSimple() const { return Segments.Num() == 1 && Segments[0].ArrayIndex == INDEX_NONE; }
+
+	// first segment: the property that owns the value on the object (used for edit notifications)
+	FProperty* GetRootProperty() const { return IsValid() ? Segments[0].Property : nullptr; }
+	// property describing the value the path ends at (the inner property for a TArray element)
+	FProperty* GetLeafProperty() const;
+
+	// address of the leaf value inside Object; null if an index is out of range or an object link is empty.
+	// OutOwner receives the object that actually holds the value (differs after a sub-object hop).
+	void* ResolveValuePtr(UObject* Object, UObject** OutOwner = nullptr) const;
+
+	bool ExportValue(UObject* Object, FString& OutText) const;
+	bool ImportValue(UObject* Object, const FString& Text) const;
+};
@@ -4,60 +4,343 @@
 #include "CoreMinimal.h"
 #include "EditorSubsystem.h"
 #include "UObject/WeakObjectPtr.h"
+#include "Containers/Ticker.h"
+#include "Async/Future.h"
+#include "PinVarPropertyPath.h"
+#include "PinVarGroups.h"
 #include "PinVarSubsystem.generated.h"
 
-struct FPinnedVariable
+struct FStreamableHandle;
+
+// outcome of resolving one pin against the loaded editor state
+enum class EPinVarResolveResult : uint8
+{
+	Unknown, // not validated yet this session
+	Ok,
+	MissingClass,
+	MissingComponent,
+	MissingProperty,
+	MissingAsset,
+};
+
+PINVAR_API const TCHAR* LexToString(EPinVarResolveResult Result);
+
+inline bool IsBrokenPin(EPinVarResolveResult Result)
+{
+	return Result != EPinVarResolveResult::Unknown && Result != EPinVarResolveResult::Ok;
+}
+
+// One pinned property: (class, component/asset, variable) is stored once, whatever groups it is in.
+struct PINVAR_API FPinnedVariable
 {
 	FPinnedVariable() = default;
 
-	FPinnedVariable(FName InVar, FName InGroup, FName InComp = NAME_None, FName InCompVarPretty = NAME_None,
+	// group ids come from UPinVarSubsystem::GroupTable (FindOrAddPath)
+	FPinnedVariable(FName InVar, TArray<int32> InGroupIds, FName InComp = NAME_None, FName InCompVarPretty = NAME_None,
 	                FSoftObjectPath Path = FSoftObjectPath())
 		: VariableName(InVar)
-		  , GroupName(InGroup)
+		  , GroupIds(MoveTemp(InGroupIds))
 		  , ComponentTemplateName(InComp)
 		  , ComponentVariablePrettyName(InCompVarPretty)
 		  , AssetPath(Path)
 	{
 	}
 
+	// returns how many memberships were new
+	int32 AddGroups(const TArray<int32>& InGroupIds);
+
 	// persisted
 	FName VariableName{NAME_None};
-	FName GroupName{NAME_None};
+	TArray<int32> GroupIds; // may include merged-away ids; resolve through the group table
 	FName ComponentTemplateName{NAME_None}; // template subobject name on CDO (e.g. AmbrosiaHealth_GEN_VARIABLE)
 	FName ComponentVariablePrettyName{NAME_None};
 	// SCS variable name (e.g. AmbrosiaHealth) — optional but helps resolution
 	FSoftObjectPath AssetPath;
-	// session-only (not persisted)
+	// session state lives in UPinVarSubsystem::PinStates, so copies of a pin carry only these fields
+};
+
+// identity of a pin within its class (groups are not part of it); used to dedupe bulk stages in O(1)
+struct FPinKey
+{
+	FName VariableName;
+	FName ComponentTemplateName;
+	FSoftObjectPath AssetPath;
+
+	FPinKey() = default;
+	FPinKey(FName InVar, FName InComp, const FSoftObjectPath& InAsset)
+		: VariableName(InVar)
+		  , ComponentTemplateName(InComp)
+		  , AssetPath(InAsset)
+	{
+	}
+
+	explicit FPinKey(const FPinnedVariable& E)
+		: FPinKey(E.VariableName, E.ComponentTemplateName, E.AssetPath)
+	{
+	}
+
+	bool operator==(const FPinKey& Other) const
+	{
+		return VariableName == Other.VariableName
+			&& ComponentTemplateName == Other.ComponentTemplateName
+			&& AssetPath == Other.AssetPath;
+	}
+
+	friend uint32 GetTypeHash(const FPinKey& K)
+	{
+		uint32 H = HashCombine(GetTypeHash(K.VariableName), GetTypeHash(K.ComponentTemplateName));
+		return HashCombine(H, GetTypeHash(K.AssetPath));
+	}
+};
+
+// Session-only state of one pin (never persisted), kept beside the records (UPinVarSubsystem::GetPinState)
+struct FPinVarPinState
+{
 	TWeakObjectPtr<UObject> ResolvedTemplate; // resolved component template for this session
+	EPinVarResolveResult ResolveState = EPinVarResolveResult::Unknown; // last validation result
+};
+
+// Group membership of one pin before and after a recorded edit (see FPinVarPinTransaction).
+// Paths back up the ids in case a group record was pruned in between.
+struct FPinVarPinDelta
+{
+	FName ClassName;
+	FPinnedVariable Pin; // identity and persisted fields
+	TArray<int32> GroupsBefore; // empty = not pinned
+	TArray<int32> GroupsAfter;
+	TArray<FString> PathsBefore;
+	TArray<FString> PathsAfter;
 };
 
+// contents of a pins file: the group tree and the pins that reference it
+struct FPinVarPinsFile
+{
+	FPinVarGroupTable Groups;
+	TMap<FName, TArray<FPinnedVariable>> Pins;
+};
+
+// one value assignment for ApplyValueBatch; ValueText uses the FProperty::ExportText format
+struct FPinVarValueWrite
+{
+	TWeakObjectPtr<UObject> Target;
+	FName VariableName;
+	FString ValueText;
+};
+
+// one CSV row that differs from the live value (import preview)
+struct FPinVarValueChange
+{
+	FPinVarValueWrite Write;
+	FName ClassName;
+	FString OldValue;
+};
+
+// Group that changed and whether only its name did (rows can keep their widgets) or the tree shape too
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnPinVarGroupsChanged, int32 /*GroupId*/, bool /*bRenameOnly*/);
+// pins of these classes were added or removed by undo/redo
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnPinVarPinsChanged, const TSet<FName>& /*Classes*/);
+
 UCLASS()
-class UPinVarSubsystem : public UEditorSubsystem
+class PINVAR_API UPinVarSubsystem : public UEditorSubsystem
 {
 	GENERATED_BODY()
 
 public:
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
 
-	TMap<FName, TArray<FPinnedVariable>> PinnedGroups;
+	// Initialize only parses the pins file on a worker thread. Entry points that need the pins call
+	// EnsurePinsLoaded (waits for that parse); the panel calls EnsureResolved, which also resolves
+	// component templates and starts validation. Nothing is resolved or loaded if nobody asks.
+	void EnsurePinsLoaded();
+	void EnsureResolved();
+	bool ArePinsLoaded() const { return !PendingParse.IsValid(); }
+
+	// the single store of pins, class -> entries. Staging edits it directly; MergeStagedIntoPinned compacts it.
 	TMap<FName, TArray<FPinnedVariable>> StagedPinnedGroups;
+	// read view used by the UI (same storage; no mirror copy)
+	const TMap<FName, TArray<FPinnedVariable>>& GetPinnedGroups() const { return StagedPinnedGroups; }
+	// session state per (class, pin); Find / the getters return defaults for pins not resolved this session.
+	// MergeStagedIntoPinned drops the state of pins that are gone.
+	FPinVarPinState& GetPinState(FName ClassName, const FPinKey& Key);
+	const FPinVarPinState* FindPinState(FName ClassName, const FPinnedVariable& Pin) const;
+	EPinVarResolveResult GetResolveState(FName ClassName, const FPinnedVariable& Pin) const;
+	UObject* GetResolvedTemplate(FName ClassName, const FPinnedVariable& Pin) const;
+	// bumped by every MergeStagedIntoPinned (adds, removals, loads, imports, undo/redo), so callers can cache
+	// what they derive from the pins
+	uint32 GetPinsRevision() const { return PinsRevision; }
+
+	// Groups are records with ids and parent links; pins hold ids. Rename, move and merge edit only the
+	// group records, so neither the pins nor their lines in the saved file change.
+	FPinVarGroupTable GroupTable;
+	bool RenameGroup(int32 GroupId, FName NewName);
+	bool MoveGroup(int32 GroupId, int32 NewParentId);
+	bool MergeGroups(int32 FromId, int32 IntoId);
+	FOnPinVarGroupsChanged OnGroupsChanged;
 
 	void StagePinVariable(FName ClassName, FName VariableName, FName GroupName,
 	                      FName ComponentTemplateName = NAME_None);
 	void StagePinVariableForDataAsset(FName ClassName, FName VariableName, FName GroupName, UObject* DataAssetInstance);
+	// stages one entry per asset path without loading anything; returns how many were new
+	int32 StagePinVariableForAssetPaths(FName ClassName, FName VariableName, FName GroupName,
+	                                    const TArray<FSoftObjectPath>& AssetPaths);
+	// every asset of AssetClass (and subclasses) known to the asset registry
+	int32 StagePinVariableForAssetsOfClass(FName ClassName, FName VariableName, FName GroupName,
+	                                       const UClass* AssetClass);
+	static void GatherAssetPathsOfClass(const UClass* AssetClass, TArray<FSoftObjectPath>& OutPaths);
 	void StagePinVariableWithTemplate(FName ClassName, FName VariableName, FName GroupName,
 	                                  FName ComponentTemplateName, UObject* TemplatePtr,
 	                                  FName ComponentVariablePrettyName = NAME_None);
 
-	bool UnstagePinVariable(FName ClassName, FName VariableName, FName GroupName,
-	                        FName ComponentTemplateName = NAME_None);
+	// Stages many entries for one class with a single hashed dedupe pass. An entry that is already
+	// pinned only gains the new group memberships. Returns how many pins or memberships were new.
+	int32 StagePinBatch(FName ClassName, const TArray<FPinnedVariable>& Entries);
+
+	// drops the pin from GroupId (and groups merged into it); the pin itself goes once it is in no group.
+	// GroupId 0 removes it from all groups.
+	bool UnstagePinVariable(FName ClassName, FName VariableName, int32 GroupId,
+	                        FName ComponentTemplateName = NAME_None,
+	                        const FSoftObjectPath& AssetPath = FSoftObjectPath());
 	void MergeStagedIntoPinned();
 
+	// Undo/redo of a recorded pin edit: sets the listed pins to one side of their deltas, saves, and
+	// reports the touched classes through OnPinsChanged. Nothing else in the store is touched.
+	void ApplyPinDeltas(const TArray<FPinVarPinDelta>& Deltas, bool bRevert);
+	FOnPinVarPinsChanged OnPinsChanged;
+
 	void RepopulateSessionCacheAll();
+	// re-resolves component templates of one class, e.g. after its Blueprint was recompiled
+	void RepopulateSessionCache(FName ClassName);
+
+	// Applies every write inside one transaction (single undo step). Each object is modified and
+	// notified once, and every touched package is marked dirty once. Returns the number of writes applied.
+	int32 ApplyValueBatch(const TArray<FPinVarValueWrite>& Writes, const FText& TransactionText);
+
+	// Value presets: exported text of every pinned value in a group and its subgroups, one file per preset
+	// under PinVar/Presets. Capturing and applying load the data assets involved. Save returns how many
+	// values were captured (0 on failure); Apply writes only values that differ, through ApplyValueBatch.
+	int32 SavePreset(int32 GroupId, const FString& PresetName);
+	int32 ApplyPreset(const FString& PresetName);
+	static FString GetPresetsDir();
+	static void GetPresetNames(TArray<FString>& OutNames);
+
+	// CSV round-trip of every pinned value: Class,Property,Component,Asset,Groups,Value (quoted as needed).
+	// Export writes row by row to disk without building widgets and returns the row count (INDEX_NONE on
+	// failure). Read streams the file line by line, matches rows to pins through a hashed index and keeps
+	// only rows whose value differs; apply the result with ApplyValueBatch. Unloaded assets are loaded in one batch.
+	int32 ExportValuesCsv(const FString& FilePath);
+	bool ReadValuesCsv(const FString& FilePath, TArray<FPinVarValueChange>& OutChanges, int32& OutRowsRead,
+	                   int32& OutRowsSkipped);
+	static FString GetValuesCsvPath();
 
 	// Persistence
 	bool SaveToDisk() const;
 	bool LoadFromDisk();
+	// Reads and parses a pins file into Out; touches no UObjects, so it is safe off the game thread.
+	// Version 1 files (class -> entries with a "Group" path list) are converted to the group table.
+	static bool ParsePinsFile(const FString& FilePath, FPinVarPinsFile& Out);
+	static constexpr int32 PinsFileVersion = 2;
 	static FString GetPinsFilePath();
-	static bool ContainsTriple(const TArray<FPinnedVariable>& Arr, FName Var, FName Group, FName Comp);
+	// file actually read/written by Load/SaveToDisk; honours PinsFileOverride
+	FString GetActivePinsFilePath() const;
+
+	// Resolution (shared by the panel and the commandlet).
+	// ResolveClassByName accepts "Foo" or "Foo_C"; with an index from BuildGeneratedClassIndex it
+	// skips the asset registry scan, otherwise it scans Blueprint tags and loads only the match.
+	static UClass* ResolveClassByName(FName ClassName,
+	                                  const TMap<FName, FSoftObjectPath>* GeneratedClassIndex = nullptr);
+	static void BuildGeneratedClassIndex(TMap<FName, FSoftObjectPath>& OutIndex);
+	static UObject* FindComponentTemplate(UClass* Class, FName TemplateName);
+	// Compiled path for VariableName on Owner ("Var", "Struct.Member", "Array[2].Member"); null if it
+	// does not resolve. Compiled once per (struct, name) and dropped on Blueprint compile / reinstancing.
+	static TSharedPtr<const FPinVarPropertyPath> FindPropertyPath(const UStruct* Owner, FName VariableName);
+	// the compiled path of a pin on Owner (FindPropertyPath with the pin's variable name)
+	static TSharedPtr<const FPinVarPropertyPath> GetPinPropertyPath(const FPinnedVariable& Pin, const UStruct* Owner);
+	static void InvalidatePropertyPaths();
+
+	// Change counter for one pinned (object, top-level property); the first call starts watching the pair.
+	// Bumped by edits from anywhere (details panels, undo/redo, PinVar itself) so rows can re-export only
+	// what changed. RootProperty NAME_None watches the whole object.
+	uint32 GetValueSerial(const UObject* Object, FName RootProperty);
+	// Read-only value of a top-level AssetRegistrySearchable property of an unloaded asset, taken from its
+	// registry tag (same text as ExportText). False for nested paths and untagged properties; never loads.
+	static bool GetUnloadedValuePreview(const FSoftObjectPath& AssetPath, FName VariableName, FString& OutValue);
+	// Cancels an in-flight load or releases a finished one, then resets Handle. Once nothing else
+	// references the assets, GC can reclaim them.
+	static void ReleaseLoadHandle(TSharedPtr<FStreamableHandle>& Handle);
+	// never loads; unloaded assets report MissingAsset. OutProperty is the leaf of the pinned path.
+	EPinVarResolveResult ResolvePin(FName ClassName, UClass* Class, const FPinnedVariable& Pin,
+	                                UObject*& OutTarget, FProperty*& OutProperty) const;
+
+	// Time-sliced validation: once asset discovery has finished, every staged pin is resolved once
+	// and the result is cached in the pin's FPinVarPinState so refreshes skip dead pins for free.
+	// Unloaded data assets are checked against the asset registry only; nothing is loaded for them.
+	void RequestValidation();
+	bool IsValidating() const { return ValidationTicker.IsValid() || FilesLoadedHandle.IsValid(); }
+	int32 GetNumBrokenPins() const;
+	FSimpleMulticastDelegate OnPinsValidated;
+
+	// redirects persistence away from the project file (benchmarks, tooling); empty = project file
+	FString PinsFileOverride;
+	static FPinnedVariable* FindPin(TArray<FPinnedVariable>& Arr, const FPinKey& Key);
+
+private:
+	friend struct FPinVarPinTransaction;
+	void BeginPinTransaction();
+	void EndPinTransaction(const FText& Description);
+	// remembers the pre-edit membership of a pin the first time an open transaction touches it
+	void NotePinTouched(FName ClassName, const FPinKey& Key);
+	int32 PinTransactionDepth = 0;
+	TMap<TPair<FName, FPinKey>, FPinVarPinDelta> PinTransactionDeltas;
+
+	void StartValidationPass();
+	bool TickValidation(float DeltaTime);
+	// "Foo" or "Foo_C", in memory only
+	static UClass* FindLoadedClass(FName ClassName);
+	EPinVarResolveResult ValidatePin(FName ClassName, UClass* Class, const FPinnedVariable& Pin) const;
+	// ResolvePin's target step, but loads an unloaded data asset; only for explicit user actions
+	UObject* LoadPinTarget(FName ClassName, UClass* Class, const FPinnedVariable& Pin) const;
+	// one blocking async batch instead of a TryLoad per pin
+	static void LoadAssetsBatched(const TArray<FSoftObjectPath>& Paths);
+
+	void OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event);
+	void OnObjectTransacted(UObject* Object, const class FTransactionObjectEvent& Event);
+	void BumpValueSerial(const UObject* Object, FName RootProperty);
+	// after GC: drops the counters of objects that were collected
+	void PruneValueSerials();
+
+	FDelegateHandle ObjectsReplacedHandle;
+	FDelegateHandle BlueprintCompiledHandle;
+	FDelegateHandle PropertyChangedHandle;
+	FDelegateHandle ObjectTransactedHandle;
+	FDelegateHandle PostGarbageCollectHandle;
+	// watched object -> (top-level property -> serial); only pairs some row asked about are tracked
+	TMap<FObjectKey, TMap<FName, uint32>> ValueSerials;
+	void RepopulateClassEntries(FName ClassName, TArray<FPinnedVariable>& Entries);
+	void InstallParsedPins(FPinVarPinsFile&& Parsed);
+
+	TMap<TPair<FName, FPinKey>, FPinVarPinState> PinStates;
+
+	TFuture<FPinVarPinsFile> PendingParse;
+	bool bSessionResolved = false;
+	uint32 PinsRevision = 0;
+
+	FTSTicker::FDelegateHandle ValidationTicker;
+	FDelegateHandle FilesLoadedHandle;
+	TArray<FName> ValidationQueue; // class buckets still to validate in this pass
+	TMap<FName, FSoftObjectPath> ValidationClassIndex;
+	bool bValidationIndexBuilt = false;
+	TSharedPtr<FStreamableHandle> ValidationLoadHandle; // keeps the pass's classes resident until it ends
+};
+
+// Records every pin add/remove made through the subsystem while alive as one editor undo step.
+// Nests; only the outermost scope emits the transaction, and only if something changed.
+struct PINVAR_API FPinVarPinTransaction
+{
+	FPinVarPinTransaction(UPinVarSubsystem* InSubsystem, const FText& InDescription);
+	~FPinVarPinTransaction();
+
+private:
+	TWeakObjectPtr<UPinVarSubsystem> Subsystem;
+	FText Description;
 };
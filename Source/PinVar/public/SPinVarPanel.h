@@ -2,6 +2,7 @@
 #pragma once
 
 #include "Widgets/SCompoundWidget.h"
+#include "PinVarSubsystem.h"
 
 class SSearchableComboBox;
 class ISinglePropertyView;
@@ -11,9 +12,15 @@ class UObject;
 class UActorComponent;
 struct FAssetData;
 class FProperty;
+template <typename ItemType> class SListView;
+class SPinVarTable;
+class SWidgetSwitcher;
 
-class SPinVarPanel : public SCompoundWidget
+class PINVAR_API SPinVarPanel : public SCompoundWidget
 {
+	// PinVarTests times GatherPinnedProperties / Rebuild directly
+	friend struct FPinVarPanelBenchmark;
+
 public:
 	SLATE_BEGIN_ARGS(SPinVarPanel)
 		{
@@ -22,9 +29,16 @@ public:
 		SLATE_EVENT(FSimpleDelegate, OnRefreshRequested)
 	SLATE_END_ARGS()
 
+	virtual ~SPinVarPanel() override;
+
 	static FString PrettyBlueprintDisplayName(const UClass* Cls);
 	void Construct(const FArguments& InArgs);
+	// rebuilds the visible view from the subsystem's in-memory pins
 	void Refresh();
+	// asks the owner (OnRefreshRequested) to re-read the pins file, then refreshes
+	void ReloadFromDisk();
+	// recompiled / reinstanced / newly discovered classes: re-resolve their pins and rebuild only their sections
+	void RefreshClasses(const TSet<FName>& Classes);
 
 private:
 	// Toolbar actions
@@ -40,10 +54,47 @@ private:
 	void GatherComponentPropsByTemplate(UObject* CompTemplate, TArray<FName>& OutProps) const;
 
 	// UI build
+	void SetTableMode(bool bEnable);
+	void RebuildActiveView();
 	void Rebuild();
-	void GatherPinnedProperties();
+	// OnlyClasses: re-collect just those classes and swap their existing sections in place.
+	// Returns false when that is not enough (new group, broken set changed); the caller then rebuilds.
+	bool GatherPinnedProperties(const TSet<FName>* OnlyClasses = nullptr);
+	void OnObjectsReplaced(const TMap<UObject*, UObject*>& ReplacementMap);
+
+	// GroupId 0 removes the pin from every group
+	FReply OnRemovePinned(FName ClassName, FName VarName, int32 GroupId, FName CompName,
+	                      FSoftObjectPath AssetPath);
+
+	// group headers read their label from the group record, so a rename repaints without a rebuild
+	TSharedRef<SWidget> MakeGroupHeader(int32 GroupId);
+	void ShowEditGroupDialog(int32 GroupId);
+	void OnGroupsChanged(int32 GroupId, bool bRenameOnly);
+
+	// spreadsheet round-trip through PinVar/Values.csv; import previews the differing rows before applying
+	FReply OnExportValuesCsv();
+	FReply OnImportValuesCsv();
+	void ShowValuesImportDialog(TArray<FPinVarValueChange>&& Changes, int32 RowsSkipped);
 
-	FReply OnRemovePinned(FName ClassName, FName VarName, FName GroupName, FName CompName);
+	// lazy asset loading for groups that contain unloaded data-asset pins
+	void OnGroupExpansionChanged(bool bExpanded, int32 GroupKey);
+	void RequestGroupAssets(int32 GroupKey);
+	void ReleaseGroupAssets(int32 GroupKey);
+	bool IsGroupExpanded(int32 GroupKey) const;
+	void OnGroupAssetsLoaded(int32 NumAssets);
+	// predictive prefetch: a collapsed group starts loading when its header is hovered or scrolls near the
+	// viewport, and lets go again if the pointer or the view moves on before it is expanded
+	void WatchGroupHover(int32 GroupKey, const TSharedRef<class SExpandableArea>& Area);
+	void OnGroupHoverChanged(int32 GroupKey, bool bHovered);
+	void UpdateScrollPrefetch();
+	void PrefetchGroupAssets(int32 GroupKey);
+	void CancelPrefetch(int32 GroupKey);
+	// a finished prefetch swaps in the sections of the classes it loaded assets for, next tick and coalesced
+	void OnGroupPrefetched(int32 GroupKey, int32 NumAssets);
+	// unloaded data asset: read-only registry value plus an Edit button that loads just that asset
+	TSharedRef<SWidget> MakeAssetPreviewRow(FName ClassName, FName VarName, const FString& Preview, int32 GroupId,
+	                                        const FSoftObjectPath& AssetPath);
+	void RequestAssetForEdit(const FSoftObjectPath& AssetPath, FName ClassName);
 	// Small utils
 	static bool IsSkelOrReinst(const UClass* C);
 	static bool IsEditableProperty(const FProperty* P);
@@ -52,11 +103,15 @@ private:
 
 	FSimpleDelegate OnRefreshRequested;
 	TSharedPtr<SVerticalBox> RootBox;
+	TSharedPtr<class SScrollBox> ListScrollBox;
+	TSharedPtr<SPinVarTable> Table;
+	TSharedPtr<SWidgetSwitcher> ViewSwitcher;
+	bool bTableMode = false;
 
-	FName ClassName{}; //weird bypass for illegal fname in func
 	struct FEntry
 	{
 		FName Group;
+		int32 GroupId;
 		TSharedRef<SWidget> Widget;
 	};
 
@@ -67,8 +122,39 @@ private:
 	TWeakPtr<class SWindow> AddVariableWindow;
 
 	//add stuff to allow groups to remain open between 
-	TMap<FName, bool> GroupExpandedState;
-	TMap<FName, TWeakPtr<class SExpandableArea>> GroupAreaWidgets;
+	// (keyed by group id, so renaming or moving a group keeps its state)
+	TMap<int32, bool> GroupExpandedState;
+	TMap<int32, TWeakPtr<class SExpandableArea>> GroupAreaWidgets;
+
+	// group -> data assets its rows need (resident or not), and the handle holding them while the group is
+	// expanded. Collapsing releases the handle so GC can reclaim what only PinVar was keeping alive.
+	TMap<int32, TSet<FSoftObjectPath>> AssetsByGroup;
+	TMap<int32, TSet<FName>> AssetClassesByGroup; // pinned classes of those assets
+	TMap<int32, TSharedPtr<struct FStreamableHandle>> GroupLoadHandles;
+	// assets loaded because a preview row was opened for editing; released with the group that shows them
+	TMap<FSoftObjectPath, TSharedPtr<struct FStreamableHandle>> EditLoadHandles;
+	// collapsed groups loading ahead of an expected expand; expanding hands them over to GroupLoadHandles
+	TMap<int32, TSharedPtr<struct FStreamableHandle>> PrefetchHandles;
+	int32 HoveredGroup = 0;
+	TSet<int32> NearViewGroups;
+	TSet<FName> PrefetchedClasses; // awaiting the deferred section refresh
+	bool bDeferredRebuildPending = false;
+	bool bPrefetchRefreshPending = false;
+
+	// (group id, class) -> box holding that class's section, swapped by RefreshClasses
+	TMap<TPair<int32, FName>, TWeakPtr<class SBox>> ClassSectionHolders;
+	// classes reinstanced since the last tick; refreshed together once the compile settles
+	TSet<FName> ReplacedClasses;
+
+	// pins that no longer resolve, listed in their own section instead of being dropped silently
+	struct FBrokenPin
+	{
+		FName ClassName;
+		FPinnedVariable Pin;
+		EPinVarResolveResult Reason;
+	};
+	TArray<FBrokenPin> BrokenPins;
+	int32 NumPinsAwaitingDiscovery = 0;
 
 public:
 	struct FCompOption
@@ -78,12 +164,26 @@ public:
 		TWeakObjectPtr<UActorComponent> Template;
 	};
 
+	// filterable multi-select list backing the Add dialog
+	struct FChecklist : public TSharedFromThis<FChecklist>
+	{
+		TArray<TSharedPtr<FString>>* Source = nullptr;
+		TArray<TSharedPtr<FString>> Filtered;
+		FString Filter;
+		TSet<FString>* Checked = nullptr; // owned by FState
+		TWeakPtr<SListView<TSharedPtr<FString>>> ListView;
+
+		void ApplyFilter();
+	};
+
 	struct FState : public TSharedFromThis<FState>
 	{
 		UBlueprint* BP = nullptr;
 		UClass* Class = nullptr;
 		bool bIsDataAssetClass = false;
 		TWeakObjectPtr<UObject> DataAssetInstance;
+		bool bAllAssetsOfClass = false; // stage for every registry asset of Class instead of the instance
+		int32 NumAssetsOfClass = 0;
 
 		enum class ESourceType : uint8
 		{
@@ -105,11 +205,27 @@ public:
 		TSharedPtr<FCompOption> CompSel;
 
 		TArray<TSharedPtr<FString>> CompPropOpts;
-		TSharedPtr<FString> CompPropSel;
-		TSharedPtr<SSearchableComboBox> CompPropCombo;
 
 		TArray<TSharedPtr<FCompOption>> CompOpts;
 
+		// multi-select state (Blueprint dialog); component checks are keyed by template name
+		TSet<FString> CheckedLocalVars;
+		TSet<FString> CheckedNativeProps;
+		TMap<FName, TSet<FString>> CheckedCompProps;
+		TSharedPtr<FChecklist> LocalVarList;
+		TSharedPtr<FChecklist> NativePropList;
+		TSharedPtr<FChecklist> CompPropList;
+
+		// optional nested member path ("Movement.MaxSpeed"); pinned in addition to the checked variables
+		FString PathStr;
+
+		int32 NumChecked() const
+		{
+			int32 N = CheckedLocalVars.Num() + CheckedNativeProps.Num() + (PathStr.TrimStartAndEnd().IsEmpty() ? 0 : 1);
+			for (const TPair<FName, TSet<FString>>& Pair : CheckedCompProps) { N += Pair.Value.Num(); }
+			return N;
+		}
+
 		FString GroupStr;
 		TArray<FString> AllGroups;
 
@@ -122,10 +238,25 @@ private:
 	static bool IsBPDeclared(const FProperty* P);
 	static bool IsNativeDeclared(const FProperty* P);
 	static bool IsSimpleStruct(const UScriptStruct* SS);
-	UClass* ResolveGeneratedClassByShortName();
 	static bool IsComplexStructContainer(const FProperty* P);
 	static bool IsContainerProperty(const FProperty* P);
-	static UObject* FindComponentTemplate(UClass* Class, FName TemplateName);
-	static void BuildComponentOptions(UBlueprint* BP, UClass* Class, TArray<TSharedPtr<FCompOption>>& Out);
+	static TSharedRef<SWidget> MakeNestedMemberRow(UObject* Target, FName Path);
+	void BuildComponentOptions(UClass* Class, TArray<TSharedPtr<FCompOption>>& Out);
+	void OnBlueprintCompiled();
+	void OnPinsValidated();
+	TSharedRef<SWidget> MakeBrokenPinsSection();
+	FReply OnRemoveAllBroken();
+	static TSharedRef<SWidget> MakeChecklistWidget(TSharedRef<FChecklist> List);
+	void CommitCheckedPins(FState& S, const TArray<FName>& Groups);
+	static FName CompileNestedPath(const FState& S, const UStruct* Owner);
+	static TSharedRef<SWidget> MakeNestedPathField(TSharedRef<FState> S);
 	FString GroupStr;
+
+	// component options per class, rebuilt after compiles / manual refresh
+	TMap<TWeakObjectPtr<UClass>, TArray<TSharedPtr<FCompOption>>> ComponentOptionsCache;
+	FDelegateHandle BlueprintCompiledHandle;
+	FDelegateHandle ObjectsReplacedHandle;
+	FDelegateHandle PinsValidatedHandle;
+	FDelegateHandle GroupsChangedHandle;
+	FDelegateHandle PinsChangedHandle;
 };
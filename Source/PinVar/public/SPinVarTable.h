@@ -0,0 +1,77 @@
+﻿// SPinVarTable.h
+#pragma once
+
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+#include "UObject/SoftObjectPath.h"
+
+class SHeaderRow;
+class SSearchableComboBox;
+class SPinVarTableCell;
+struct FStreamableHandle;
+
+// One table row = one edit target (class defaults, a component template or a data asset)
+struct FPinVarTableRow
+{
+	FName ClassName;
+	FName ComponentTemplateName;
+	FSoftObjectPath AssetPath;
+	FText Label;
+	FText SubLabel;
+
+	TSet<FName> PinnedVars; // columns that apply to this target
+	TWeakObjectPtr<UObject> Target; // data assets resolve once their async load finishes
+	TSharedPtr<FStreamableHandle> LoadHandle;
+	TMap<FName, FString> Previews; // registry-tag values shown while the asset is not loaded
+	FSimpleDelegate OnLoaded; // e.g. a cell waiting to start editing
+
+};
+
+// Spreadsheet view of pinned variables: targets as rows, pinned properties as columns.
+// Rows are virtualized; cells show exported text and only host a property editor while edited.
+class SPinVarTable : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SPinVarTable)
+		{
+		}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	// re-read pins from the subsystem and rebuild rows/columns
+	void Refresh();
+
+	// only one cell hosts a full property editor at a time
+	void SetEditingCell(const TSharedPtr<SPinVarTableCell>& Cell);
+	void RequestRowLoad(const TSharedRef<FPinVarTableRow>& Row);
+
+	// changes whenever Target's top-level property does (any editor, undo/redo, batch writes)
+	uint32 GetValueSerial(const UObject* Target, FName RootProperty) const;
+
+	static const FName TargetColumnId;
+
+private:
+	TSharedRef<ITableRow> OnGenerateRow(TSharedPtr<FPinVarTableRow> Row, const TSharedRef<STableViewBase>& Owner);
+	void OnRowReleased(const TSharedRef<ITableRow>& RowWidget);
+	void ApplyFilter();
+	void RebuildColumns();
+	FReply OnSetOnSelected();
+	void PrefillBatchValue();
+
+	TArray<TSharedPtr<FPinVarTableRow>> AllRows;
+	TArray<TSharedPtr<FPinVarTableRow>> FilteredRows;
+	TArray<FName> Columns;
+	FString FilterText;
+
+	TSharedPtr<SHeaderRow> HeaderRow;
+	TSharedPtr<SListView<TSharedPtr<FPinVarTableRow>>> ListView;
+	TWeakPtr<SPinVarTableCell> EditingCell;
+
+	// "set value on selected rows"
+	TArray<TSharedPtr<FString>> ColumnOptions;
+	TSharedPtr<FString> BatchColumn;
+	FString BatchValue;
+	TSharedPtr<SSearchableComboBox> BatchColumnCombo;
+	TWeakObjectPtr<class UPinVarSubsystem> SubsystemWeak;
+};
@@ -0,0 +1,21 @@
+using UnrealBuildTool;
+
+public class PinVarTests : ModuleRules
+{
+	public PinVarTests(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PrivateDependencyModuleNames.AddRange(new string[]
+		{
+			"Core",
+			"CoreUObject",
+			"Engine",
+			"Slate",
+			"SlateCore",
+			"UnrealEd",
+			"Json",
+			"PinVar"
+		});
+	}
+}
@@ -0,0 +1,33 @@
+// PinVarBenchmarkDataAsset.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "PinVarBenchmarkDataAsset.generated.h"
+
+// Transient data asset the benchmarks and tests pin against, so asset pins resolve without touching content
+UCLASS(Transient, HideDropdown)
+class UPinVarBenchmarkDataAsset : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, Category = "Benchmark")
+	float Damage = 10.f;
+
+	UPROPERTY(EditAnywhere, Category = "Benchmark")
+	float Cooldown = 1.f;
+
+	UPROPERTY(EditAnywhere, Category = "Benchmark")
+	int32 MaxStacks = 3;
+
+	UPROPERTY(EditAnywhere, Category = "Benchmark")
+	FName Tag;
+
+	UPROPERTY(EditAnywhere, Category = "Benchmark")
+	FVector Offset = FVector::ZeroVector;
+
+	// free text, so the values CSV round trip sees line breaks, quotes and commas
+	UPROPERTY(EditAnywhere, Category = "Benchmark")
+	FString Notes;
+};
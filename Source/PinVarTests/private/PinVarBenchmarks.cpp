@@ -0,0 +1,345 @@
+// PinVarBenchmarks.cpp
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Components/ActorComponent.h"
+#include "GameFramework/Actor.h"
+#include "UObject/StrongObjectPtr.h"
+#include "UObject/UObjectIterator.h"
+#include "UObject/Package.h"
+#include "Editor.h"
+
+#include "PinVarSubsystem.h"
+#include "SPinVarPanel.h"
+#include "PinVarBenchmarkDataAsset.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Friend of SPinVarPanel: exposes the private build steps to the benchmark
+struct FPinVarPanelBenchmark
+{
+	static void Gather(SPinVarPanel& Panel) { Panel.GatherPinnedProperties(); }
+	static void Rebuild(SPinVarPanel& Panel) { Panel.Rebuild(); }
+};
+
+namespace PinVarBenchmark
+{
+	// widget benchmarks build one property row per pin; past this size they need -PinVarBenchAllWidgets
+	constexpr int32 MaxPinsForWidgetBenchmarks = 10000;
+	constexpr int32 MaxSourcesPerKind = 64;
+
+	struct FPinSource
+	{
+		FName ClassName;
+		FName ComponentTemplateName; // NAME_None for class defaults
+		TArray<FName> Properties;
+	};
+
+	// scalar, template-editable properties only, so every pin produces the same cheap row type
+	bool IsBenchProperty(const FProperty* P)
+	{
+		return P
+			&& P->HasAnyPropertyFlags(CPF_Edit)
+			&& !P->HasAnyPropertyFlags(CPF_EditConst | CPF_DisableEditOnTemplate | CPF_Transient)
+			&& (P->IsA<FNumericProperty>() || P->IsA<FBoolProperty>() || P->IsA<FNameProperty>()
+				|| P->IsA<FStrProperty>());
+	}
+
+	void GatherProperties(const UClass* Cls, TArray<FName>& Out)
+	{
+		for (TFieldIterator<FProperty> It(Cls, EFieldIteratorFlags::IncludeSuper); It; ++It)
+		{
+			if (IsBenchProperty(*It)) Out.Add(It->GetFName());
+		}
+	}
+
+	// native actor classes and their default component templates, in a stable order
+	void CollectSources(TArray<FPinSource>& OutClasses, TArray<FPinSource>& OutComponents)
+	{
+		for (TObjectIterator<UClass> It; It; ++It)
+		{
+			UClass* Cls = *It;
+			if (!Cls->IsNative() || !Cls->IsChildOf(AActor::StaticClass())) continue;
+			if (Cls->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated | CLASS_NewerVersionExists)) continue;
+
+			FPinSource ClassSrc{Cls->GetFName()};
+			GatherProperties(Cls, ClassSrc.Properties);
+			if (ClassSrc.Properties.Num() > 0) OutClasses.Add(MoveTemp(ClassSrc));
+
+			UObject* CDO = Cls->GetDefaultObject();
+			ForEachObjectWithOuter(CDO, [&](UObject* O)
+			{
+				const UActorComponent* Comp = Cast<UActorComponent>(O);
+				if (!Comp) return;
+
+				FPinSource CompSrc{Cls->GetFName(), Comp->GetFName()};
+				GatherProperties(Comp->GetClass(), CompSrc.Properties);
+				if (CompSrc.Properties.Num() > 0) OutComponents.Add(MoveTemp(CompSrc));
+			}, /*bIncludeNestedObjects*/ false);
+		}
+
+		auto ByName = [](const FPinSource& A, const FPinSource& B)
+		{
+			return A.ClassName != B.ClassName
+				       ? A.ClassName.LexicalLess(B.ClassName)
+				       : A.ComponentTemplateName.LexicalLess(B.ComponentTemplateName);
+		};
+		OutClasses.Sort(ByName);
+		OutComponents.Sort(ByName);
+		OutClasses.SetNum(FMath::Min(OutClasses.Num(), MaxSourcesPerKind));
+		OutComponents.SetNum(FMath::Min(OutComponents.Num(), MaxSourcesPerKind));
+	}
+
+	// 3/5 class defaults, 1/5 components, 1/5 data assets, spread over 16 groups x 8 subgroups
+	int32 GeneratePins(UPinVarSubsystem& Subsystem, int32 NumPins,
+	                   TArray<TStrongObjectPtr<UPinVarBenchmarkDataAsset>>& OutAssets)
+	{
+		TArray<FPinSource> Classes;
+		TArray<FPinSource> Components;
+		CollectSources(Classes, Components);
+
+		const int32 NumAssets = FMath::Max(1, NumPins / 50);
+		OutAssets.Reset(NumAssets);
+		for (int32 A = 0; A < NumAssets; ++A)
+		{
+			OutAssets.Emplace(NewObject<UPinVarBenchmarkDataAsset>(
+				GetTransientPackage(), *FString::Printf(TEXT("PinVarBench_%d"), A), RF_Transient));
+		}
+		TArray<FName> AssetProps;
+		GatherProperties(UPinVarBenchmarkDataAsset::StaticClass(), AssetProps);
+		const FName AssetClassName = UPinVarBenchmarkDataAsset::StaticClass()->GetFName();
+
+		TMap<FName, TArray<FPinnedVariable>> Batches;
+		for (int32 i = 0; i < NumPins; ++i)
+		{
+			const int32 Slot = i / 5;
+			const int32 Group = Subsystem.GroupTable.FindOrAddPath(
+				FString::Printf(TEXT("Bench%02d|Sub%d"), Slot % 16, (Slot / 16) % 8));
+
+			const int32 Kind = i % 5;
+			if (Kind == 3 && Components.Num() > 0)
+			{
+				const FPinSource& Src = Components[Slot % Components.Num()];
+				const FName Var = Src.Properties[(Slot / Components.Num()) % Src.Properties.Num()];
+				Batches.FindOrAdd(Src.ClassName).Add(FPinnedVariable(Var, {Group}, Src.ComponentTemplateName));
+			}
+			else if (Kind == 4 && AssetProps.Num() > 0)
+			{
+				UObject* Asset = OutAssets[Slot % NumAssets].Get();
+				const FName Var = AssetProps[(Slot / NumAssets) % AssetProps.Num()];
+				Batches.FindOrAdd(AssetClassName).Add(
+					FPinnedVariable(Var, {Group}, NAME_None, NAME_None, FSoftObjectPath(Asset)));
+			}
+			else if (Classes.Num() > 0)
+			{
+				const FPinSource& Src = Classes[(Slot * 3 + Kind) % Classes.Num()];
+				const FName Var = Src.Properties[(Slot / Classes.Num()) % Src.Properties.Num()];
+				Batches.FindOrAdd(Src.ClassName).Add(FPinnedVariable(Var, {Group}));
+			}
+		}
+
+		Subsystem.StagedPinnedGroups.Reset();
+		int32 Staged = 0;
+		for (const TPair<FName, TArray<FPinnedVariable>>& Pair : Batches)
+		{
+			Staged += Subsystem.StagePinBatch(Pair.Key, Pair.Value);
+		}
+		return Staged;
+	}
+
+	// class -> pin identity -> its group paths, sorted; ids are not compared since a reload may renumber them
+	TMap<FName, TMap<FPinKey, FString>> SnapshotPins(const UPinVarSubsystem& Subsystem)
+	{
+		TMap<FName, TMap<FPinKey, FString>> Out;
+		for (const TPair<FName, TArray<FPinnedVariable>>& Pair : Subsystem.StagedPinnedGroups)
+		{
+			TMap<FPinKey, FString>& ClassPins = Out.FindOrAdd(Pair.Key);
+			for (const FPinnedVariable& E : Pair.Value)
+			{
+				TArray<FString> Paths;
+				for (const int32 Id : E.GroupIds) { Paths.AddUnique(Subsystem.GroupTable.GetPath(Id)); }
+				Paths.Sort();
+				ClassPins.Add(FPinKey(E), FString::Join(Paths, TEXT(", ")));
+			}
+		}
+		return Out;
+	}
+
+	int32 CountPins(const TMap<FName, TMap<FPinKey, FString>>& Snapshot)
+	{
+		int32 Num = 0;
+		for (const TPair<FName, TMap<FPinKey, FString>>& Pair : Snapshot) { Num += Pair.Value.Num(); }
+		return Num;
+	}
+
+	template <typename FuncType>
+	double TimeMs(FuncType&& Func)
+	{
+		const double Start = FPlatformTime::Seconds();
+		Func();
+		return (FPlatformTime::Seconds() - Start) * 1000.0;
+	}
+
+	FString GetOutputDir()
+	{
+		return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("PinVar"), TEXT("Benchmarks"));
+	}
+
+	// one CSV row per operation (appended across runs) plus a JSON snapshot of the latest run per size
+	void WriteResults(int32 RequestedPins, int32 StagedPins, const TArray<TPair<FString, double>>& Timings)
+	{
+		const FString Dir = GetOutputDir();
+		IFileManager::Get().MakeDirectory(*Dir, /*Tree*/true);
+		const FString Stamp = FDateTime::UtcNow().ToIso8601();
+
+		const FString CsvPath = FPaths::Combine(Dir, TEXT("PinVarBenchmarks.csv"));
+		FString Csv;
+		if (!FPaths::FileExists(CsvPath))
+		{
+			Csv += TEXT("Timestamp,RequestedPins,StagedPins,Operation,Milliseconds\n");
+		}
+		for (const TPair<FString, double>& T : Timings)
+		{
+			Csv += FString::Printf(TEXT("%s,%d,%d,%s,%.3f\n"), *Stamp, RequestedPins, StagedPins, *T.Key, T.Value);
+		}
+		FFileHelper::SaveStringToFile(Csv, *CsvPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM,
+		                              &IFileManager::Get(), FILEWRITE_Append);
+
+		TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+		Root->SetStringField(TEXT("Timestamp"), Stamp);
+		Root->SetNumberField(TEXT("RequestedPins"), RequestedPins);
+		Root->SetNumberField(TEXT("StagedPins"), StagedPins);
+		TSharedRef<FJsonObject> Results = MakeShared<FJsonObject>();
+		for (const TPair<FString, double>& T : Timings)
+		{
+			Results->SetNumberField(T.Key, T.Value);
+		}
+		Root->SetObjectField(TEXT("Milliseconds"), Results);
+
+		FString Json;
+		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+		FJsonSerializer::Serialize(Root, Writer);
+		FFileHelper::SaveStringToFile(
+			Json, *FPaths::Combine(Dir, FString::Printf(TEXT("PinVarBenchmark_%d.json"), RequestedPins)),
+			FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+	}
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FPinVarBenchmarkTest, "PinVar.Benchmark",
+                                  EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+void FPinVarBenchmarkTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const int32 NumPins : {1000, 10000, 100000})
+	{
+		OutBeautifiedNames.Add(FString::Printf(TEXT("%dPins"), NumPins));
+		OutTestCommands.Add(LexToString(NumPins));
+	}
+}
+
+bool FPinVarBenchmarkTest::RunTest(const FString& Parameters)
+{
+	using namespace PinVarBenchmark;
+
+	const int32 NumPins = FCString::Atoi(*Parameters);
+	UPinVarSubsystem* Subsystem = GEditor ? GEditor->GetEditorSubsystem<UPinVarSubsystem>() : nullptr;
+	if (!TestNotNull(TEXT("PinVar subsystem"), Subsystem) || NumPins <= 0)
+	{
+		return false;
+	}
+
+	// keep the user's pins and file untouched
+	Subsystem->EnsurePinsLoaded();
+	const TMap<FName, TArray<FPinnedVariable>> SavedStaged = Subsystem->StagedPinnedGroups;
+	const FPinVarGroupTable SavedGroups = Subsystem->GroupTable;
+	const FString SavedOverride = Subsystem->PinsFileOverride;
+
+	const FString TempFile = FPaths::Combine(GetOutputDir(), FString::Printf(TEXT("Pinned_%d.json"), NumPins));
+	IFileManager::Get().Delete(*TempFile, /*RequireExists*/false, /*EvenReadOnly*/true);
+	Subsystem->PinsFileOverride = TempFile;
+
+	TArray<TStrongObjectPtr<UPinVarBenchmarkDataAsset>> Assets;
+	TArray<TPair<FString, double>> Timings;
+
+	const int32 Staged = GeneratePins(*Subsystem, NumPins, Assets);
+	AddInfo(FString::Printf(TEXT("Generated %d unique pins (%d requested), %d bytes each."), Staged, NumPins,
+	                        static_cast<int32>(sizeof(FPinnedVariable))));
+
+	const TMap<FName, TMap<FPinKey, FString>> Before = SnapshotPins(*Subsystem);
+
+	bool bSaved = false;
+	bool bLoaded = false;
+	Timings.Emplace(TEXT("SaveToDisk"), TimeMs([&] { bSaved = Subsystem->SaveToDisk(); }));
+	Timings.Emplace(TEXT("LoadFromDisk"), TimeMs([&] { bLoaded = Subsystem->LoadFromDisk(); }));
+	Timings.Emplace(TEXT("MergeStagedIntoPinned"), TimeMs([&] { Subsystem->MergeStagedIntoPinned(); }));
+	Timings.Emplace(TEXT("RepopulateSessionCacheAll"), TimeMs([&] { Subsystem->RepopulateSessionCacheAll(); }));
+	TestTrue(TEXT("SaveToDisk succeeded"), bSaved);
+	TestTrue(TEXT("LoadFromDisk succeeded"), bLoaded);
+
+	// the round trip must give back exactly the pins that were saved, with the same group memberships
+	const TMap<FName, TMap<FPinKey, FString>> After = SnapshotPins(*Subsystem);
+	TestEqual(TEXT("Pin count after Save/Load/Merge"), CountPins(After), Staged);
+	TestEqual(TEXT("Classes after Save/Load/Merge"), After.Num(), Before.Num());
+	int32 Mismatched = 0;
+	for (const TPair<FName, TMap<FPinKey, FString>>& Pair : Before)
+	{
+		const TMap<FPinKey, FString>* Loaded = After.Find(Pair.Key);
+		for (const TPair<FPinKey, FString>& Pin : Pair.Value)
+		{
+			const FString* Groups = Loaded ? Loaded->Find(Pin.Key) : nullptr;
+			if (Groups && *Groups == Pin.Value) continue;
+			if (++Mismatched <= 5)
+			{
+				AddError(FString::Printf(TEXT("%s.%s (%s): groups '%s' after reload, expected '%s'"),
+				                         *Pair.Key.ToString(), *Pin.Key.VariableName.ToString(),
+				                         *Pin.Key.ComponentTemplateName.ToString(),
+				                         Groups ? **Groups : TEXT("<missing>"), *Pin.Value));
+			}
+		}
+	}
+	TestEqual(TEXT("Pins that differ after Save/Load/Merge"), Mismatched, 0);
+
+	const bool bWidgets = NumPins <= MaxPinsForWidgetBenchmarks || FParse::Param(FCommandLine::Get(), TEXT("PinVarBenchAllWidgets"));
+	if (!FSlateApplication::IsInitialized())
+	{
+		AddWarning(TEXT("Slate is not initialized; skipping panel benchmarks."));
+	}
+	else if (!bWidgets)
+	{
+		AddInfo(FString::Printf(TEXT("Skipping panel benchmarks above %d pins (pass -PinVarBenchAllWidgets)."),
+		                        MaxPinsForWidgetBenchmarks));
+	}
+	else
+	{
+		TSharedPtr<SPinVarPanel> Panel;
+		Timings.Emplace(TEXT("PanelConstruct"), TimeMs([&] { Panel = SNew(SPinVarPanel); }));
+		Timings.Emplace(TEXT("GatherPinnedProperties"), TimeMs([&] { FPinVarPanelBenchmark::Gather(*Panel); }));
+		Timings.Emplace(TEXT("Rebuild"), TimeMs([&] { FPinVarPanelBenchmark::Rebuild(*Panel); }));
+		Panel.Reset();
+	}
+
+	for (const TPair<FString, double>& T : Timings)
+	{
+		AddInfo(FString::Printf(TEXT("%-28s %10.3f ms"), *T.Key, T.Value));
+	}
+	WriteResults(NumPins, Staged, Timings);
+
+	Subsystem->StagedPinnedGroups = SavedStaged;
+	Subsystem->GroupTable = SavedGroups;
+	Subsystem->PinsFileOverride = SavedOverride;
+	// merge drops the synthetic pins' session state and bumps the revision so views re-gather
+	Subsystem->MergeStagedIntoPinned();
+	Subsystem->RepopulateSessionCacheAll();
+	IFileManager::Get().Delete(*TempFile, /*RequireExists*/false, /*EvenReadOnly*/true);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
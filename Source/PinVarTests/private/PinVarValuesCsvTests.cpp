@@ -0,0 +1,66 @@
+// PinVarValuesCsvTests.cpp
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "UObject/StrongObjectPtr.h"
+#include "UObject/Package.h"
+#include "Editor.h"
+
+#include "PinVarSubsystem.h"
+#include "PinVarBenchmarkDataAsset.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPinVarValuesCsvRoundTripTest, "PinVar.ValuesCsv.RoundTrip",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FPinVarValuesCsvRoundTripTest::RunTest(const FString& Parameters)
+{
+	UPinVarSubsystem* Subsystem = GEditor ? GEditor->GetEditorSubsystem<UPinVarSubsystem>() : nullptr;
+	if (!TestNotNull(TEXT("PinVar subsystem"), Subsystem))
+	{
+		return false;
+	}
+
+	// keep the user's pins and file untouched
+	Subsystem->EnsurePinsLoaded();
+	const TMap<FName, TArray<FPinnedVariable>> SavedStaged = Subsystem->StagedPinnedGroups;
+	const FPinVarGroupTable SavedGroups = Subsystem->GroupTable;
+
+	const TStrongObjectPtr<UPinVarBenchmarkDataAsset> Asset(NewObject<UPinVarBenchmarkDataAsset>(
+		GetTransientPackage(), TEXT("PinVarCsvRoundTrip"), RF_Transient));
+	const FString Original = TEXT("first line, with a comma\nsecond \"quoted\" line\n\nafter a blank line");
+	Asset->Notes = Original;
+
+	const FName ClassName = UPinVarBenchmarkDataAsset::StaticClass()->GetFName();
+	const FName VarName = GET_MEMBER_NAME_CHECKED(UPinVarBenchmarkDataAsset, Notes);
+	Subsystem->StagedPinnedGroups.Reset();
+	Subsystem->StagePinBatch(ClassName, {FPinnedVariable(VarName, {Subsystem->GroupTable.FindOrAddPath(TEXT("CsvTest"))},
+	                                                     NAME_None, NAME_None, FSoftObjectPath(Asset.Get()))});
+	Subsystem->MergeStagedIntoPinned();
+
+	const FString CsvPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("PinVar"), TEXT("ValuesCsvRoundTrip.csv"));
+	TestEqual(TEXT("Exported rows"), Subsystem->ExportValuesCsv(CsvPath), 1);
+
+	// the import reports what differs from the live value, so change it and expect the original back
+	Asset->Notes = TEXT("changed");
+	TArray<FPinVarValueChange> Changes;
+	int32 RowsRead = 0;
+	int32 RowsSkipped = 0;
+	TestTrue(TEXT("ReadValuesCsv succeeded"), Subsystem->ReadValuesCsv(CsvPath, Changes, RowsRead, RowsSkipped));
+	TestEqual(TEXT("Rows read"), RowsRead, 1);
+	TestEqual(TEXT("Rows skipped"), RowsSkipped, 0);
+	if (TestEqual(TEXT("Changes"), Changes.Num(), 1))
+	{
+		TestEqual(TEXT("Round-tripped value"), Changes[0].Write.ValueText, Original);
+		TestEqual(TEXT("Live value before import"), Changes[0].OldValue, FString(TEXT("changed")));
+	}
+
+	Subsystem->StagedPinnedGroups = SavedStaged;
+	Subsystem->GroupTable = SavedGroups;
+	Subsystem->MergeStagedIntoPinned();
+	IFileManager::Get().Delete(*CsvPath, /*RequireExists*/false, /*EvenReadOnly*/true);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS